@@ -0,0 +1,113 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// MOOSE includes
+#include "Moose.h"
+
+#include "json/json.h"
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <functional>
+#include <string>
+#include <vector>
+
+class FEProblemBase;
+
+/**
+ * A single timed operation. run() is called repeatedly and must do the same amount of work on
+ * every call.
+ */
+struct Benchmark
+{
+  Benchmark(const std::string & name,
+            std::function<void()> run,
+            std::size_t items = 1,
+            std::function<void()> set_up = nullptr,
+            std::function<void()> tear_down = nullptr)
+    : name(name), run(run), items(items), set_up(set_up), tear_down(tear_down)
+  {
+  }
+
+  /// Name used in the report, "<group>/<operation>"
+  std::string name;
+
+  /// The timed operation
+  std::function<void()> run;
+
+  /// Number of items (elements, queries, property evaluations, ...) processed by one call to run()
+  std::size_t items;
+
+  /// Called once before the timing to prepare the state used by run() (optional)
+  std::function<void()> set_up;
+
+  /// Called once after the timing to undo the changes made by run() (optional)
+  std::function<void()> tear_down;
+};
+
+/**
+ * Times Benchmark objects and collects the results in a JSON report.
+ *
+ * Every benchmark is called once to estimate the number of calls needed for a sample to take at
+ * least the minimum sample time. All processors use the same number of calls so that benchmarks
+ * containing collective operations stay synchronized, and the time of a sample is the maximum
+ * over all processors.
+ */
+class BenchmarkRunner
+{
+public:
+  BenchmarkRunner(const Parallel::Communicator & comm, Real min_sample_time, unsigned int samples);
+
+  /**
+   * Times the benchmark and adds its result to the report
+   */
+  void run(const Benchmark & benchmark);
+
+  /**
+   * The report containing the settings and one entry per benchmark. All times are in seconds per
+   * call to Benchmark::run.
+   */
+  moosecontrib::Json::Value & report() { return _report; }
+
+protected:
+  /// Time taken by the given number of calls to the benchmark, maximum over all processors
+  Real timeCalls(const Benchmark & benchmark, unsigned int calls) const;
+
+  const Parallel::Communicator & _comm;
+
+  /// Minimum time spent in each sample
+  const Real _min_sample_time;
+
+  /// Number of samples taken for each benchmark
+  const unsigned int _samples;
+
+  moosecontrib::Json::Value _report;
+};
+
+///@{
+/**
+ * Add the benchmarks of a group of hot paths. The problem passed in is built from the benchmark
+ * input file and initialized.
+ */
+void addTensorBenchmarks(std::vector<Benchmark> & benchmarks);
+void addDataIOBenchmarks(std::vector<Benchmark> & benchmarks);
+void addKDTreeBenchmarks(std::vector<Benchmark> & benchmarks);
+void addFluidPropertiesBenchmarks(std::vector<Benchmark> & benchmarks, FEProblemBase & problem);
+void addProblemBenchmarks(std::vector<Benchmark> & benchmarks, FEProblemBase & problem);
+///@}
+
+#endif // BENCHMARK_H
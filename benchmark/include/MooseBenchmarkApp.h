@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MOOSEBENCHMARKAPP_H
+#define MOOSEBENCHMARKAPP_H
+
+#include "MooseApp.h"
+
+class MooseBenchmarkApp;
+
+template <>
+InputParameters validParams<MooseBenchmarkApp>();
+
+/**
+ * Application used by the benchmark executable. It registers the framework objects and the
+ * modules that provide the benchmarked objects.
+ */
+class MooseBenchmarkApp : public MooseApp
+{
+public:
+  MooseBenchmarkApp(const InputParameters & parameters);
+  virtual ~MooseBenchmarkApp();
+};
+
+#endif /* MOOSEBENCHMARKAPP_H */
@@ -37,10 +37,14 @@ public:
   FunctionAux(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateValue() override;
   virtual Real computeValue() override;
 
   /// Function being used to compute the value of this kernel
   Function & _func;
+
+  /// Function values at the quadrature points of the current element
+  std::vector<Real> _values;
 };
 
 #endif // FUNCTIONAUX_H
@@ -568,6 +568,12 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Bytes held by the local residual and Jacobian blocks, the shape functions, and the cached
+   * element and residual/Jacobian data, see MemoryUsageBreakdown.
+   */
+  std::size_t memoryUsage() const;
+
   std::map<FEType, bool> _need_second_derivative;
 
   /**
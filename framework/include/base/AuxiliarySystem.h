@@ -28,6 +28,7 @@ class FEProblemBase;
 class TimeIntegrator;
 class AuxScalarKernel;
 class AuxKernel;
+class ComputeUserObjectsThread;
 
 // libMesh forward declarations
 namespace libMesh
@@ -112,8 +113,20 @@ public:
   /**
    * Compute auxiliary variables
    * @param type Time flag of which variables should be computed
+   * @param user_objects Loop over UserObjects that the block restricted elemental AuxKernels are
+   *                     computed in, instead of in a traversal of their own
    */
-  virtual void compute(ExecFlagType type);
+  virtual void compute(ExecFlagType type, ComputeUserObjectsThread * user_objects = nullptr);
+
+  /**
+   * Whether there are active block restricted elemental AuxKernels for this exec type
+   */
+  bool hasActiveElementalBlockKernels(ExecFlagType type) const;
+
+  /**
+   * Get the names of the variables computed by the elemental AuxKernels for this exec type
+   */
+  std::set<std::string> getElementalVariableNames(ExecFlagType type) const;
 
   /**
    * Get a list of dependent UserObjects for this exec type
@@ -168,7 +181,7 @@ public:
 protected:
   void computeScalarVars(ExecFlagType type);
   void computeNodalVars(ExecFlagType type);
-  void computeElementalVars(ExecFlagType type);
+  void computeElementalVars(ExecFlagType type, ComputeUserObjectsThread * user_objects);
 
   FEProblemBase & _fe_problem;
 
@@ -206,6 +219,7 @@ protected:
   friend class ComputeNodalAuxBcsThread;
   friend class ComputeElemAuxVarsThread;
   friend class ComputeElemAuxBcsThread;
+  friend class ComputeUserObjectsThread;
   friend class ComputeIndicatorThread;
   friend class ComputeMarkerThread;
   friend class FlagElementsThread;
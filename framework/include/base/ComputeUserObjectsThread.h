@@ -20,6 +20,10 @@
 
 #include "libmesh/elem_range.h"
 
+// Forward declarations
+class AuxiliarySystem;
+class AuxKernel;
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -52,9 +56,28 @@ public:
 
   void join(const ComputeUserObjectsThread & /*y*/);
 
+  /**
+   * Also compute the given block restricted elemental AuxKernels on each element, reusing the
+   * element and material reinitialization of the UserObjects (see the fuse_element_loops
+   * parameter of FEProblemBase)
+   */
+  void fuseAuxKernels(const MooseObjectWarehouse<AuxKernel> & aux_kernels);
+
 protected:
+  /**
+   * Compute the fused AuxKernels on the current element and store the results in the solution of
+   * the auxiliary system
+   */
+  void computeAuxKernels();
+
   const NumericVector<Number> & _soln;
 
+  /// The auxiliary system, used when AuxKernels are fused into this loop
+  AuxiliarySystem & _aux_sys;
+
+  /// The elemental AuxKernels fused into this loop, nullptr if there are none
+  const MooseObjectWarehouse<AuxKernel> * _aux_kernels;
+
   ///@{
   /// Storage for UserObjects (see FEProblemBase::computeUserObjects)
   const MooseObjectWarehouse<ElementUserObject> & _elemental_user_objects;
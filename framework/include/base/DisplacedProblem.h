@@ -282,7 +282,27 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /// Whether or not the geometric searches have been updated for the current node positions
+  bool _geometric_search_current;
+
+  /// Solution vectors ghosted on all the displacement dofs of the mesh (built by
+  /// UpdateDisplacedMeshThread and reused until the mesh changes)
+  std::shared_ptr<NumericVector<Number>> _nl_ghosted_soln;
+  std::shared_ptr<NumericVector<Number>> _aux_ghosted_soln;
+
+  /// The send lists used for localizing into the ghosted solution vectors
+  std::vector<dof_id_type> _nl_send_list;
+  std::vector<dof_id_type> _aux_send_list;
+
 private:
+  /**
+   * Updates the geometric searches and the DiracKernel point locator, unless no node moved since
+   * they were last updated.
+   *
+   * @param mesh_moved Whether or not any local node moved in the last mesh update
+   */
+  void updateGeometricSearch(bool mesh_moved);
+
   friend class UpdateDisplacedMeshThread;
   friend class Restartable;
 };
@@ -0,0 +1,143 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ELEMENTLOOPSCHEDULER_H
+#define ELEMENTLOOPSCHEDULER_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/elem_range.h"
+
+#include <atomic>
+
+/**
+ * Hands out chunks of the active local elements to the threads of an element loop on demand.
+ *
+ * The chunks are sized so that each carries about the same amount of work, based on the cost of
+ * every element measured during previous loops, and the most expensive chunks are handed out
+ * first. Threads that finish early keep taking chunks, so the load stays balanced even when the
+ * cost per element varies by orders of magnitude across the mesh.
+ */
+class ElementLoopScheduler
+{
+public:
+  /**
+   * @param chunks_per_thread The number of chunks created for every thread
+   * @param smoothing Weight of the newest measurement in the cost of an element
+   */
+  ElementLoopScheduler(unsigned int chunks_per_thread = 8, Real smoothing = 0.5);
+
+  /**
+   * Rebuilds the element list from the supplied range. The costs of elements that are still in
+   * the range are kept.
+   */
+  void reinit(const ConstElemRange & range);
+
+  /**
+   * Whether the element list must be rebuilt before the next loop.
+   */
+  bool needsReinit() const { return _needs_reinit; }
+
+  /**
+   * Marks the element list as outdated, e.g. after the mesh changed.
+   */
+  void invalidate() { _needs_reinit = true; }
+
+  /**
+   * Sets the cost of the elements that have not been measured yet.
+   * @param work The cost of every element indexed by element id
+   */
+  void seedCosts(const std::vector<Real> & work);
+
+  /**
+   * Prepares a new element loop: folds the costs measured during the previous loop into the cost
+   * history and rebuilds the chunks.
+   */
+  void start();
+
+  /**
+   * Claims the next chunk of elements. This may be called concurrently by all threads.
+   * @param begin The position of the first element of the chunk
+   * @param end One past the position of the last element of the chunk
+   * @return false when all chunks have been handed out
+   */
+  bool nextChunk(std::size_t & begin, std::size_t & end);
+
+  /**
+   * The element at the given position.
+   */
+  const Elem * elem(std::size_t i) const { return _elems[i]; }
+
+  /**
+   * Records the cost measured for the element at the given position. Every position is handed out
+   * to exactly one thread, so no locking is needed.
+   */
+  void recordCost(std::size_t i, Real cost) { _measured[i] = cost; }
+
+  /**
+   * The scheduled elements and the cost of each, a negative cost meaning not yet measured.
+   */
+  const std::vector<const Elem *> & elems() const { return _elems; }
+  const std::vector<Real> & costs() const { return _costs; }
+
+  /**
+   * The ids of the scheduled elements, which unlike the element pointers stay safe to use after
+   * the mesh changed.
+   */
+  const std::vector<dof_id_type> & elemIds() const { return _elem_ids; }
+
+  /**
+   * The cost assumed for elements that have not been measured yet: the mean of the measured costs
+   * or one if there are none.
+   */
+  Real defaultCost() const;
+
+  /**
+   * The number of chunks of the current loop.
+   */
+  std::size_t numChunks() const { return _chunk_order.size(); }
+
+protected:
+  /// Number of chunks created for every thread
+  const unsigned int _chunks_per_thread;
+
+  /// Weight of the newest measurement in the cost of an element
+  const Real _smoothing;
+
+  /// The scheduled elements
+  std::vector<const Elem *> _elems;
+
+  /// The ids of the scheduled elements, used to carry the costs over when the list is rebuilt
+  std::vector<dof_id_type> _elem_ids;
+
+  /// The cost history of every element
+  std::vector<Real> _costs;
+
+  /// The costs measured during the current loop
+  std::vector<Real> _measured;
+
+  /// The first position of every chunk, followed by the number of elements
+  std::vector<std::size_t> _chunk_bounds;
+
+  /// The order in which the chunks are handed out
+  std::vector<std::size_t> _chunk_order;
+
+  /// The next entry of _chunk_order to hand out
+  std::atomic<std::size_t> _next_chunk;
+
+  /// Whether the element list must be rebuilt
+  bool _needs_reinit;
+};
+
+#endif // ELEMENTLOOPSCHEDULER_H
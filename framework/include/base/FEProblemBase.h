@@ -32,6 +32,7 @@
 #include "MooseVariableBase.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
+#include "ReductionAggregator.h"
 
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
@@ -1101,6 +1102,29 @@ public:
 
   virtual void meshChanged() override;
 
+  /**
+   * Repartitions the mesh by the element costs measured during the residual and Jacobian
+   * evaluations if the work imbalance between the processors exceeds rebalance_threshold. The
+   * stateful material properties are moved to the new owners of their elements.
+   * @return true if the mesh was repartitioned
+   */
+  virtual bool rebalanceMesh();
+
+  ///@{
+  /**
+   * The ratio of the largest to the average processor work before and after the last rebalance
+   * check. The value after is predicted from the measured element costs.
+   */
+  Real imbalanceBeforeRebalance() const { return _imbalance_before_rebalance; }
+  Real imbalanceAfterRebalance() const { return _imbalance_after_rebalance; }
+  ///@}
+
+  /**
+   * Whether the mesh change currently being processed is a repartitioning by rebalanceMesh(),
+   * which moves elements between processors but leaves the mesh itself unchanged
+   */
+  bool repartitioningMesh() const { return _repartitioning_mesh; }
+
   /**
    * Register an object that derives from MeshChangedInterface
    * to be notified when the mesh changes.
@@ -1232,6 +1256,10 @@ public:
   template <typename T>
   void initializeUserObjects(const MooseObjectWarehouse<T> & warehouse);
   template <typename T>
+  void setupUserObjects(const MooseObjectWarehouse<T> & warehouse, const ExecFlagType & type);
+  template <typename T>
+  void joinUserObjects(const MooseObjectWarehouse<T> & warehouse);
+  template <typename T>
   void finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse);
 
   /**
@@ -1382,6 +1410,10 @@ protected:
   // VectorPostprocessors
   VectorPostprocessorData _vpps_data;
 
+  /// Reduces the partial values of the user objects finalized together with one communication
+  /// per operation
+  ReductionAggregator _reductions;
+
   ///@{
   /// Storage for UserObjects
   ExecuteMooseObjectWarehouse<UserObject> _all_user_objects;
@@ -1539,6 +1571,69 @@ private:
   /// At or beyond initialSteup stage
   bool _started_initial_setup;
 
+  /// The processor work imbalance above which the mesh is repartitioned
+  const Real _rebalance_threshold;
+
+  /// The number of time steps between checks of the processor work imbalance
+  const unsigned int _rebalance_interval;
+
+  ///@{ Work imbalance before and after the last rebalance check
+  Real _imbalance_before_rebalance;
+  Real _imbalance_after_rebalance;
+  ///@}
+
+  /// True while meshChanged() is called because rebalanceMesh() repartitioned the mesh
+  bool _repartitioning_mesh;
+
+  /// Whether Post-aux UserObjects are executed in the traversal of the elemental AuxKernels
+  const bool _fuse_element_loops;
+
+  /// The execute flag whose Post-aux UserObjects were partly executed with the AuxKernels
+  ExecFlagType _fused_user_objects_type;
+
+  /**
+   * The Post-aux element, side and internal side UserObjects of an execute flag split into those
+   * executed along with the elemental AuxKernels (fused) and those that need a traversal of their
+   * own (unfused)
+   */
+  struct FusedUserObjects
+  {
+    /// Whether any UserObject is executed along with the AuxKernels
+    bool _has_fused = false;
+
+    MooseObjectWarehouse<ElementUserObject> _fused_elemental;
+    MooseObjectWarehouse<SideUserObject> _fused_side;
+    MooseObjectWarehouse<InternalSideUserObject> _fused_internal_side;
+    MooseObjectWarehouse<ElementUserObject> _unfused_elemental;
+    MooseObjectWarehouse<SideUserObject> _unfused_side;
+    MooseObjectWarehouse<InternalSideUserObject> _unfused_internal_side;
+  };
+
+  /// The split of the Post-aux UserObjects by execute flag, built on first use and cleared when
+  /// the active objects or the mesh change (see clearFusedUserObjects())
+  std::map<ExecFlagType, FusedUserObjects> _fused_user_objects;
+
+  /**
+   * Get the split of the Post-aux element, side and internal side UserObjects of an execute flag
+   * into those that can be executed along with the elemental AuxKernels and those that cannot
+   */
+  const FusedUserObjects & splitFusedUserObjects(const ExecFlagType & type);
+
+  /// Throw away the cached splits of the Post-aux UserObjects
+  void clearFusedUserObjects() { _fused_user_objects.clear(); }
+  template <typename T>
+  void splitFusedUserObjects(const MooseObjectWarehouse<T> & warehouse,
+                             const std::set<std::string> & aux_var_names,
+                             MooseObjectWarehouse<T> & fused,
+                             MooseObjectWarehouse<T> & unfused);
+
+  /**
+   * Sends the stateful material properties packed before a repartitioning to the new owners of
+   * their elements and loads them there.
+   * @param packed_props The packed properties of the elements that were local, by element id
+   */
+  void migrateStatefulMaterialProperties(const std::map<dof_id_type, std::string> & packed_props);
+
   friend class AuxiliarySystem;
   friend class NonlinearSystemBase;
   friend class MooseEigenSystem;
@@ -1572,7 +1667,21 @@ FEProblemBase::initializeUserObjects(const MooseObjectWarehouse<T> & warehouse)
 
 template <typename T>
 void
-FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
+FEProblemBase::setupUserObjects(const MooseObjectWarehouse<T> & warehouse,
+                                const ExecFlagType & type)
+{
+  for (THREAD_ID tid = 0; tid < libMesh::n_threads(); tid++)
+  {
+    if (type == EXEC_LINEAR)
+      warehouse.residualSetup(tid);
+    else if (type == EXEC_NONLINEAR)
+      warehouse.jacobianSetup(tid);
+  }
+}
+
+template <typename T>
+void
+FEProblemBase::joinUserObjects(const MooseObjectWarehouse<T> & warehouse)
 {
   if (warehouse.hasActiveObjects())
   {
@@ -1587,6 +1696,20 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
         objects[i]->threadJoin(*(other_objects[i]));
     }
 
+    // Collect the values they reduce across processors, see _reductions
+    for (auto & object : objects)
+      object->registerReductions(_reductions);
+  }
+}
+
+template <typename T>
+void
+FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
+{
+  if (warehouse.hasActiveObjects())
+  {
+    const auto & objects = warehouse.getActiveObjects(0);
+
     // Finalize them and save off PP values
     for (auto & object : objects)
     {
@@ -1596,6 +1719,8 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
 
       if (pp)
         _pps_data.storeValue(pp->PPName(), pp->getValue());
+
+      object->clearReductions();
     }
   }
 }
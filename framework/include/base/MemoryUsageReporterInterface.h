@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYUSAGEREPORTERINTERFACE_H
+#define MEMORYUSAGEREPORTERINTERFACE_H
+
+// STL includes
+#include <cstddef>
+#include <map>
+#include <string>
+
+/**
+ * Interface for objects that hold large data structures and report their size to the
+ * MemoryUsageBreakdown VectorPostprocessor.
+ */
+class MemoryUsageReporterInterface
+{
+public:
+  virtual ~MemoryUsageReporterInterface() = default;
+
+  /**
+   * Add the number of bytes held by this object on the current processor to the given categories.
+   * Categories that are not known to MemoryUsageBreakdown are accumulated in "other".
+   */
+  virtual void reportMemoryUsage(std::map<std::string, std::size_t> & bytes) const = 0;
+};
+
+#endif // MEMORYUSAGEREPORTERINTERFACE_H
@@ -444,6 +444,15 @@ public:
    */
   std::shared_ptr<Backup> backup();
 
+  /**
+   * Store the current state of this App into an existing Backup, reusing its storage.  The
+   * solution vectors and stateful material properties are copied in memory instead of being
+   * serialized.
+   *
+   * @param backup The Backup to (re)fill
+   */
+  void snapshot(Backup & backup);
+
   /**
    * Restore a Backup.  This sets the App's state.
    *
@@ -20,13 +20,30 @@
 // libMesh
 #include "libmesh/libmesh.h"
 
+/**
+ * Initializes MPI ahead of libMesh in builds that can solve the Apps of a MultiApp concurrently
+ * (see MultiApp's max_concurrent_apps), because those solves need MPI_THREAD_MULTIPLE while libMesh
+ * asks for MPI_THREAD_FUNNELED at most. It is a base of MooseInit so that MPI is finalized after
+ * libMesh and PETSc.
+ */
+class MooseMPIInit
+{
+public:
+  MooseMPIInit(int argc, char * argv[]);
+  ~MooseMPIInit();
+
+private:
+  /// Whether MPI was initialized here, and therefore has to be finalized here
+  bool _initialized_mpi;
+};
+
 /**
  * Initialization object for any MOOSE-based application
  *
  * This object must be created in the main() of any MOOSE-based application so
  * everything is properly initialized and finalized.
  */
-class MooseInit : public LibMeshInit
+class MooseInit : private MooseMPIInit, public LibMeshInit
 {
 public:
   MooseInit(int argc, char * argv[], MPI_Comm COMM_WORLD_IN = MPI_COMM_WORLD);
@@ -19,6 +19,9 @@
 #include "MooseMesh.h"
 #include "MooseTypes.h"
 #include "MooseException.h"
+#include "ElementLoopScheduler.h"
+
+#include <chrono>
 
 /**
  * Base class for assembly-like calculations.
@@ -137,10 +140,25 @@ public:
    */
   virtual bool keepGoing() { return true; }
 
+  /**
+   * Lets the loop take its elements from the supplied scheduler instead of the range it is
+   * handed, and record the cost of every element. The scheduler must have been started on the
+   * same elements as the range the loop is run on. Pass nullptr to loop over the range.
+   */
+  void setElementLoopScheduler(ElementLoopScheduler * scheduler) { _scheduler = scheduler; }
+
 protected:
+  /**
+   * Runs all the element, side and interface callbacks for one element.
+   */
+  void computeElement(const Elem * elem);
+
   MooseMesh & _mesh;
   THREAD_ID _tid;
 
+  /// Scheduler handing out the elements, or nullptr to loop over the supplied range
+  ElementLoopScheduler * _scheduler;
+
   /// The subdomain for the current element
   SubdomainID _subdomain;
 
@@ -155,14 +173,15 @@ protected:
 };
 
 template <typename RangeType>
-ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh) : _mesh(mesh)
+ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh)
+  : _mesh(mesh), _scheduler(nullptr)
 {
 }
 
 template <typename RangeType>
 ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(ThreadedElementLoopBase & x,
                                                             Threads::split /*split*/)
-  : _mesh(x._mesh)
+  : _mesh(x._mesh), _scheduler(x._scheduler)
 {
 }
 
@@ -184,64 +203,87 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
 
     _subdomain = Moose::INVALID_BLOCK_ID;
     _neighbor_subdomain = Moose::INVALID_BLOCK_ID;
-    typename RangeType::const_iterator el = range.begin();
-    for (el = range.begin(); el != range.end(); ++el)
+
+    if (_scheduler && !bypass_threading)
     {
-      if (!keepGoing())
-        break;
+      std::size_t begin, end;
+      while (keepGoing() && _scheduler->nextChunk(begin, end))
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          if (!keepGoing())
+            break;
 
-      const Elem * elem = *el;
+          auto start = std::chrono::steady_clock::now();
+          computeElement(_scheduler->elem(i));
+          std::chrono::duration<Real> elapsed = std::chrono::steady_clock::now() - start;
+          _scheduler->recordCost(i, elapsed.count());
+        }
+    }
+    else
+    {
+      typename RangeType::const_iterator el = range.begin();
+      for (el = range.begin(); el != range.end(); ++el)
+      {
+        if (!keepGoing())
+          break;
 
-      preElement(elem);
+        computeElement(*el);
+      } // range
+    }
 
-      _old_subdomain = _subdomain;
-      _subdomain = elem->subdomain_id();
-      if (_subdomain != _old_subdomain)
-        subdomainChanged();
+    post();
+  }
+  catch (MooseException & e)
+  {
+    caughtMooseException(e);
+  }
+}
 
-      onElement(elem);
+template <typename RangeType>
+void
+ThreadedElementLoopBase<RangeType>::computeElement(const Elem * elem)
+{
+  preElement(elem);
 
-      for (unsigned int side = 0; side < elem->n_sides(); side++)
-      {
-        std::vector<BoundaryID> boundary_ids = _mesh.getBoundaryIDs(elem, side);
+  _old_subdomain = _subdomain;
+  _subdomain = elem->subdomain_id();
+  if (_subdomain != _old_subdomain)
+    subdomainChanged();
 
-        if (boundary_ids.size() > 0)
-          for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
-               it != boundary_ids.end();
-               ++it)
-            onBoundary(elem, side, *it);
+  onElement(elem);
 
-        const Elem * neighbor = elem->neighbor_ptr(side);
-        if (neighbor != nullptr)
-        {
-          preInternalSide(elem, side);
+  for (unsigned int side = 0; side < elem->n_sides(); side++)
+  {
+    std::vector<BoundaryID> boundary_ids = _mesh.getBoundaryIDs(elem, side);
 
-          _old_neighbor_subdomain = _neighbor_subdomain;
-          _neighbor_subdomain = neighbor->subdomain_id();
-          if (_neighbor_subdomain != _old_neighbor_subdomain)
-            neighborSubdomainChanged();
+    if (boundary_ids.size() > 0)
+      for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
+           it != boundary_ids.end();
+           ++it)
+        onBoundary(elem, side, *it);
 
-          onInternalSide(elem, side);
+    const Elem * neighbor = elem->neighbor_ptr(side);
+    if (neighbor != nullptr)
+    {
+      preInternalSide(elem, side);
 
-          if (boundary_ids.size() > 0)
-            for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
-                 it != boundary_ids.end();
-                 ++it)
-              onInterface(elem, side, *it);
+      _old_neighbor_subdomain = _neighbor_subdomain;
+      _neighbor_subdomain = neighbor->subdomain_id();
+      if (_neighbor_subdomain != _old_neighbor_subdomain)
+        neighborSubdomainChanged();
 
-          postInternalSide(elem, side);
-        }
-      } // sides
-      postElement(elem);
+      onInternalSide(elem, side);
 
-    } // range
+      if (boundary_ids.size() > 0)
+        for (std::vector<BoundaryID>::iterator it = boundary_ids.begin();
+             it != boundary_ids.end();
+             ++it)
+          onInterface(elem, side, *it);
 
-    post();
-  }
-  catch (MooseException & e)
-  {
-    caughtMooseException(e);
-  }
+      postInternalSide(elem, side);
+    }
+  } // sides
+  postElement(elem);
 }
 
 template <typename RangeType>
@@ -39,11 +39,21 @@ public:
 
   virtual void onNode(NodeRange::const_iterator & nd) override;
 
-  void join(const UpdateDisplacedMeshThread & /*y*/);
+  void join(const UpdateDisplacedMeshThread & y);
+
+  /**
+   * Whether or not any of the nodes visited by this thread changed position
+   */
+  bool meshMoved() const { return _mesh_moved; }
 
 protected:
   void init();
 
+  /**
+   * Set a coordinate of a displaced node, recording whether it actually changed
+   */
+  void moveNode(Node & node, unsigned int direction, Real position);
+
   DisplacedProblem & _displaced_problem;
   MooseMesh & _ref_mesh;
   const NumericVector<Number> & _nl_soln;
@@ -55,6 +65,9 @@ protected:
   std::shared_ptr<NumericVector<Number>> _nl_ghosted_soln;
   std::shared_ptr<NumericVector<Number>> _aux_ghosted_soln;
 
+  /// Whether or not any node changed position
+  bool _mesh_moved;
+
 private:
   std::vector<unsigned int> _var_nums;
   std::vector<unsigned int> _var_nums_directions;
@@ -20,9 +20,12 @@
 #include "CoupleableMooseVariableDependencyIntermediateInterface.h"
 #include "MooseMesh.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class FaceFaceConstraint;
 class FEProblemBase;
+class PenetrationInfo;
 
 template <>
 InputParameters validParams<FaceFaceConstraint>();
@@ -80,6 +83,27 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpJacobianSide(Moose::ConstraintJacobianType jac_type);
 
+  /**
+   * Projection of the quadrature points of an element of the mortar interface onto the master and
+   * slave surfaces. It only depends on the geometry, so it is computed once per update of the
+   * penetration locators and reused in all residual and Jacobian evaluations.
+   */
+  struct MortarSegment
+  {
+    ///@{ Penetration information per quadrature point (nullptr if the point was not projected)
+    std::vector<const PenetrationInfo *> _master_pinfo;
+    std::vector<const PenetrationInfo *> _slave_pinfo;
+    ///@}
+
+    ///@{ The master and slave sides the quadrature points project onto
+    std::vector<std::unique_ptr<const Elem>> _master_sides;
+    std::vector<std::unique_ptr<const Elem>> _slave_sides;
+    ///@}
+  };
+
+  /// Get the (cached) projection data for the current element of the mortar interface
+  const MortarSegment & getMortarSegment();
+
   FEProblemBase & _fe_problem;
   unsigned int _dim;
 
@@ -164,6 +188,14 @@ protected:
    * Values of shape function on the slave side
    */
   const VariablePhiValue & _phi_slave;
+
+  /// Projection data by mortar interface element id
+  std::unordered_map<dof_id_type, MortarSegment> _mortar_segments;
+
+  ///@{ Penetration locator update counts the cached projection data was computed for
+  unsigned int _master_num_updates;
+  unsigned int _slave_num_updates;
+  ///@}
 };
 
 #endif /* FACEFACECONSTRAINT_H */
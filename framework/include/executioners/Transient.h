@@ -16,6 +16,7 @@
 #define TRANSIENT_H
 
 #include "Executioner.h"
+#include "FixedPointAcceleration.h"
 
 // System includes
 #include <string>
@@ -315,6 +316,18 @@ protected:
 
   /// The DoFs associates with all of the relaxed variables
   std::set<dof_id_type> _relaxed_dofs;
+
+  /// The transferred postprocessors that are going to be relaxed
+  std::vector<PostprocessorName> _relaxed_postprocessors;
+
+  /// The values of the relaxed postprocessors used by the last Picard iteration
+  std::vector<Real> _relaxed_postprocessor_values;
+
+  ///@{
+  /// Computes the relaxed variables and postprocessors of the next Picard iteration
+  std::unique_ptr<FixedPointAcceleration> _variable_acceleration;
+  std::unique_ptr<FixedPointAcceleration> _postprocessor_acceleration;
+  ///@}
 };
 
 #endif // TRANSIENTEXECUTIONER_H
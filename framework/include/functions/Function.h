@@ -23,6 +23,7 @@
 #include "Restartable.h"
 #include "MeshChangedInterface.h"
 #include "ScalarCoupleable.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -73,6 +74,16 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points (e.g. all quadrature points of an element).
+   * The default calls value() for every point, override it if the function can evaluate
+   * several points more efficiently.
+   * \param t The time
+   * \param points The Points in space (x,y,z)
+   * \param values The function values at each point, resized to the number of points
+   */
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
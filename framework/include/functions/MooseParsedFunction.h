@@ -51,6 +51,13 @@ public:
    */
   virtual Real value(Real t, const Point & pt) override;
 
+  /**
+   * Evaluate the equation at several points, the Postprocessor and scalar variable values are
+   * only updated once.
+   */
+  virtual void
+  values(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
+
   /**
    * Evaluate the gradient of the function. This is computed in libMesh
    * through automatic symbolic differentiation.
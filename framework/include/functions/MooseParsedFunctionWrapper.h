@@ -18,6 +18,8 @@
 // MOOSE includes
 #include "MooseError.h"
 #include "MooseTypes.h"
+#include "MooseArray.h"
+#include "FunctionParserUtils.h"
 
 #include "libmesh/parsed_function.h"
 
@@ -44,12 +46,15 @@ public:
    * @param function_str A string that contains the function to evaluate
    * @param vars A vector of variable names contained within the function
    * @param vals A vector of variable values, matching the variables defined in vars
+   * @param tid The thread id of the owning Function object
+   * @param enable_jit Whether or not to just-in-time compile scalar evaluations
    */
   MooseParsedFunctionWrapper(FEProblemBase & feproblem,
                              const std::string & function_str,
                              const std::vector<std::string> & vars,
                              const std::vector<std::string> & vals,
-                             const THREAD_ID tid = 0);
+                             const THREAD_ID tid = 0,
+                             bool enable_jit = false);
 
   /**
    * Class destruction
@@ -66,6 +71,12 @@ public:
   template <typename T>
   T evaluate(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at several points, updating the Postprocessor and scalar
+   * variable values only once.
+   */
+  void evaluate(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Evaluate the gradient of the function which libMesh provides through
    * automatic differentiation
@@ -115,6 +126,26 @@ private:
   /// The thread id passed from owning Function object
   const THREAD_ID _tid;
 
+  /// Compiled parser for scalar evaluations (null if JIT is disabled or not available)
+  FunctionParserUtils::ADFunctionPtr _jit_function;
+
+  /// Parameters passed to the compiled parser: the coordinates, time and then the vars
+  std::vector<Real> _jit_params;
+
+  /// Vector of pointers to the variables in _jit_params (empty if _jit_function is not used)
+  std::vector<Real *> _jit_addr;
+
+  /**
+   * Parses and compiles the expression for scalar evaluation, leaving _jit_function empty
+   * (so that libMesh::ParsedFunction is used) if that is not possible
+   */
+  void initializeJIT();
+
+  /**
+   * Evaluates the scalar function with the compiled parser, update() must be called first
+   */
+  Real evaluateJIT(Real t, const Point & p);
+
   /**
    * Initialization method that prepares the vars and vals for use
    * by the libMesh::ParsedFunction object allocated in the constructor
@@ -40,6 +40,13 @@ public:
    */
   virtual Real value(Real t, const Point & pt) override;
 
+  /**
+   * Get the values of the function at several points, the search for the interpolation interval
+   * of each point starts from the interval of the previous one
+   */
+  virtual void
+  values(Real t, const MooseArray<Point> & points, std::vector<Real> & values) override;
+
   /**
    * Get the time derivative of the function (based on time only)
    * \param t The time
@@ -51,6 +58,10 @@ public:
   virtual Real integral() override;
 
   virtual Real average() override;
+
+protected:
+  /// The interpolation interval of the last evaluation, used as a starting point for the next
+  unsigned int _interval;
 };
 
 #endif
@@ -67,6 +67,16 @@ private:
   /// the grid
   std::vector<std::vector<Real>> _grid;
 
+  /// Storage for the point on the grid passed to sample()
+  std::vector<Real> _pt_in_grid;
+
+  /// Storage for the indices of the hypercube containing the last sampled point
+  std::vector<unsigned int> _left;
+  std::vector<unsigned int> _right;
+
+  /// Storage for the indices of a vertex of the hypercube
+  std::vector<unsigned int> _arg;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
@@ -82,10 +92,11 @@ private:
    *
    * @param in_arr The monotonically increasing vector of real numbers
    * @param x The real value for which we want the neighbor indices
-   * @param lower_x Upon return will contain lower_x specified above
+   * @param lower_x On input the index to start searching from (e.g. the result of a previous
+   *                call), upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr,
+  void getNeighborIndices(const std::vector<Real> & in_arr,
                           Real x,
                           unsigned int & lower_x,
                           unsigned int & upper_x);
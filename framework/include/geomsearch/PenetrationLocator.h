@@ -51,6 +51,11 @@ public:
   Real penetrationDistance(dof_id_type node_id);
   RealVectorValue penetrationNormal(dof_id_type node_id);
 
+  /**
+   * Number of bytes held by the PenetrationInfo objects on this processor
+   */
+  std::size_t memoryUsage() const;
+
   enum NORMAL_SMOOTHING_METHOD
   {
     NSM_EDGE_BASED,
@@ -92,6 +97,12 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * The number of times the penetration information has been computed. Objects caching data
+   * derived from the PenetrationInfo objects use this to detect when the cache is out of date.
+   */
+  unsigned int numUpdates() const { return _num_updates; }
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -102,6 +113,9 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to
                                    // perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Counts the calls to detectPenetration()
+  unsigned int _num_updates;
 };
 
 /**
@@ -38,6 +38,7 @@ public:
   BodyForce(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateResidual() override;
   virtual Real computeQpResidual() override;
 
   /// Scale factor
@@ -48,6 +49,9 @@ protected:
 
   /// Optional Postprocessor value
   const PostprocessorValue & _postprocessor;
+
+  /// Function values at the quadrature points of the current element
+  std::vector<Real> _function_values;
 };
 
 #endif
@@ -36,6 +36,8 @@ class GenericFunctionMaterial : public Material
 public:
   GenericFunctionMaterial(const InputParameters & parameters);
 
+  virtual void computeProperties() override;
+
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
@@ -50,6 +52,9 @@ protected:
   std::vector<MaterialProperty<Real> *> _properties_older;
   std::vector<Function *> _functions;
 
+  /// Function values at the quadrature points of the current element
+  std::vector<Real> _function_values;
+
 private:
   /**
    * A helper method for evaluating the functions
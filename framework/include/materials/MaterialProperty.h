@@ -65,6 +65,12 @@ public:
    */
   virtual void resize(int n) = 0;
 
+  /**
+   * Number of bytes held by the stored values (heap storage owned by the values themselves is not
+   * included).
+   */
+  virtual std::size_t memoryUsage() const = 0;
+
   virtual void swap(PropertyValue * rhs) = 0;
 
   /**
@@ -134,6 +140,8 @@ public:
    */
   virtual void resize(int n);
 
+  virtual std::size_t memoryUsage() const override;
+
   /**
    * Get element i out of the array.
    */
@@ -228,6 +236,13 @@ MaterialProperty<T>::resize(int n)
   _value.resize(n);
 }
 
+template <typename T>
+inline std::size_t
+MaterialProperty<T>::memoryUsage() const
+{
+  return sizeof(*this) + _value.size() * sizeof(T);
+}
+
 template <typename T>
 inline void
 MaterialProperty<T>::swap(PropertyValue * rhs)
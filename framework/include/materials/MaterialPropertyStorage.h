@@ -174,11 +174,46 @@ public:
    */
   bool hasStatefulProperties() const { return _has_stateful_props; }
 
+  /**
+   * Writes the current, old and older properties of all sides of an element to a stream, e.g.
+   * to move them to another processor.
+   * @param stream The stream to write to
+   * @param elem The element, which must have properties in this storage
+   */
+  void storeElement(std::ostream & stream, const Elem * elem);
+
+  /**
+   * Reads the properties written by storeElement() into the storage of an element whose
+   * properties have already been initialized.
+   * @param stream The stream to read from
+   * @param elem The element
+   */
+  void loadElement(std::istream & stream, const Elem * elem);
+
+  /**
+   * Releases the properties of all sides of an element and removes the element from the storage.
+   * @param elem The element
+   */
+  void eraseElement(const Elem * elem);
+
+  /**
+   * Deep copies the current, old and older properties of another storage into this one, e.g. to
+   * keep an in-memory backup.  Values that already exist with the right size are overwritten in
+   * place; elements and sides that are not in the other storage are removed.
+   * @param from The storage to copy from
+   */
+  void copyProperties(const MaterialPropertyStorage & from);
+
   /**
    * @return a Boolean indicating whether or not this material has older properties declared
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Number of bytes held by the current, old, and older property values on this processor
+   */
+  std::size_t memoryUsage() const;
+
   ///@{
   /**
    * Access methods to the stored material property data
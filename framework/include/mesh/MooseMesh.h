@@ -32,6 +32,7 @@
 // forward declaration
 class MooseMesh;
 class Assembly;
+class ElementLoopScheduler;
 
 // libMesh forward declarations
 namespace libMesh
@@ -41,6 +42,7 @@ class QBase;
 class PeriodicBoundaries;
 class Partitioner;
 class GhostingFunctor;
+class ErrorVector;
 }
 
 // Useful typedefs
@@ -333,6 +335,58 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode *> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *> * getBoundaryElementRange();
 
+  /**
+   * Returns the scheduler for loops over the active local element range, started for a new loop,
+   * or nullptr if the elements are split statically among the threads.
+   */
+  ElementLoopScheduler * elementLoopScheduler();
+
+  /**
+   * Returns the scheduler for loops over the active local element range without starting a loop,
+   * or nullptr if the elements are split statically among the threads.
+   */
+  const ElementLoopScheduler * getElementLoopScheduler() const
+  {
+    return _element_loop_scheduler.get();
+  }
+
+  /**
+   * Gathers the element costs measured by the element loop scheduler on all processors. Only the
+   * measured costs are communicated, but the result holds every element, so only gather it when
+   * the costs of all elements are needed (e.g. as partitioner weights).
+   * @param work The cost of every element indexed by element id; elements without a measurement
+   * get the average cost
+   */
+  void gatherElementWork(std::vector<Real> & work) const;
+
+  /**
+   * The ratio of the largest to the average work of a processor, computed from the costs measured
+   * by the element loop scheduler without gathering them.
+   */
+  Real workImbalance() const;
+
+  /**
+   * The ratio of the largest to the average work of a processor when the elements are assigned
+   * to processors as they currently are.
+   * @param work The cost of every element indexed by element id, see gatherElementWork()
+   */
+  Real workImbalance(const std::vector<Real> & work) const;
+
+  /**
+   * Converts element costs into the integer partitioner weights METIS expects, scaled so that the
+   * average element weighs 100.
+   * @param work The cost of every element indexed by element id, see gatherElementWork()
+   * @param weights The weight of every element indexed by element id
+   */
+  void workToPartitionerWeights(const std::vector<Real> & work, ErrorVector & weights) const;
+
+  /**
+   * Seeds the element loop scheduler with the costs of elements it has not measured yet, e.g.
+   * elements that were just moved to this processor.
+   * @param work The cost of every element indexed by element id, see gatherElementWork()
+   */
+  void seedElementWork(const std::vector<Real> & work);
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -882,6 +936,9 @@ protected:
    */
   std::unique_ptr<ConstElemRange> _active_local_elem_range;
 
+  /// Hands out the active local elements to the threads when dynamic scheduling is requested
+  std::unique_ptr<ElementLoopScheduler> _element_loop_scheduler;
+
   std::unique_ptr<SemiLocalNodeRange> _active_semilocal_node_range;
   std::unique_ptr<NodeRange> _active_node_range;
   std::unique_ptr<ConstNodeRange> _local_node_range;
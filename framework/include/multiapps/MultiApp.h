@@ -17,6 +17,10 @@
 #include "MooseObject.h"
 #include "SetupInterface.h"
 #include "Restartable.h"
+#include "MemoryUsageReporterInterface.h"
+
+#include <functional>
+#include <mutex>
 
 class MultiApp;
 class UserObject;
@@ -56,11 +60,16 @@ class SubAppBackups : public std::vector<std::shared_ptr<Backup>>
  * path using "MOOSE_LIBRARY_PATH" or by specifying a single input file library path
  * in Multiapps InputParameters object.
  */
-class MultiApp : public MooseObject, public SetupInterface, public Restartable
+class MultiApp : public MooseObject,
+                 public SetupInterface,
+                 public Restartable,
+                 public MemoryUsageReporterInterface
 {
 public:
   MultiApp(const InputParameters & parameters);
 
+  virtual ~MultiApp();
+
   virtual void preExecute() {}
 
   virtual void postExecute();
@@ -123,6 +132,11 @@ public:
    */
   virtual bool needsRestoration() { return true; }
 
+  /**
+   * Reports the bytes held by the local backups in the "multiapp_backups" category
+   */
+  virtual void reportMemoryUsage(std::map<std::string, std::size_t> & bytes) const override;
+
   /**
    * @param app The global app number to get the Executioner for
    * @return The Executioner associated with that App.
@@ -291,6 +305,25 @@ protected:
    */
   unsigned int globalAppToLocal(unsigned int global_app);
 
+  /**
+   * Calls execute_app for each local App.  When "max_concurrent_apps" allows it and the
+   * libraries are able to run independent solves at the same time, up to that many Apps are
+   * executed on a pool of threads.  Otherwise the Apps are executed one after the other.
+   *
+   * If any App throws, the remaining Apps that have not been started are skipped and the
+   * exception of the lowest numbered failing App is rethrown once all threads have finished.
+   *
+   * @param execute_app Callback taking the local App number to execute.
+   * @param allow_concurrent Whether or not the caller can execute its Apps independently.
+   */
+  void executeLocalApps(const std::function<void(unsigned int)> & execute_app,
+                        bool allow_concurrent = true);
+
+  /**
+   * The number of threads executeLocalApps() will use for the local Apps.
+   */
+  unsigned int numConcurrentApps() const;
+
   /// call back executed right before app->runInputFile()
   virtual void preRunInputFile();
 
@@ -334,6 +367,10 @@ protected:
   /// The MPI communicator this object is going to use.
   MPI_Comm _my_comm;
 
+  /// The communicators the local Apps are built on; duplicates of _my_comm when the Apps are
+  /// solved concurrently, so that the collective operations of different Apps can't be matched
+  std::vector<MPI_Comm> _app_comms;
+
   /// The number of processors in the original comm
   int _orig_num_procs;
 
@@ -384,6 +421,25 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// Whether or not the backups keep the solution vectors and stateful material properties in
+  /// memory instead of serializing them
+  const bool _in_memory_backups;
+
+  /// Whether or not to print the time taken by and the bytes held by the backups
+  const bool _report_backups;
+
+  /// Number of restores of the local Apps since the last backup
+  unsigned int _num_restores;
+
+  /// Time taken by the restores of the local Apps since the last backup
+  Real _restore_time;
+
+  /// Maximum number of local Apps executed at the same time
+  const unsigned int _max_concurrent_apps;
+
+  /// Serializes access to state shared by concurrently executing Apps (e.g. the console)
+  std::mutex _concurrent_apps_mutex;
 };
 
 template <>
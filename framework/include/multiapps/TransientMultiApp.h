@@ -49,7 +49,7 @@ public:
   /**
    * Finds the smallest dt from among any of the apps.
    */
-  Real computeDT();
+  virtual Real computeDT();
 
 private:
   /**
@@ -60,6 +60,16 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Take the step (or sub-cycle up to target_time) for a single local app.
+   *
+   * @param i The local app number of the app to solve.
+   * @param dt The timestep of the master app
+   * @param target_time The global time the app should reach
+   * @param auto_advance Whether or not the app should advance on its own
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time, bool auto_advance);
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -18,6 +18,9 @@
 // MOOSE includes
 #include "Output.h"
 
+// C++ includes
+#include <mutex>
+
 // Forward declarations
 class FEProblemBase;
 class InputParameters;
@@ -299,6 +302,13 @@ private:
    */
   void flushConsoleBuffer();
 
+  /**
+   * The mutex held while output objects write. The file formats (ExodusII/netCDF in particular)
+   * and the shared console are not thread safe, so Apps that are solved concurrently by a
+   * MultiApp take turns writing their output, including the output from the PETSc monitors.
+   */
+  static std::mutex & outputMutex();
+
   /// MooseApp
   MooseApp & _app;
 
@@ -124,10 +124,18 @@ private:
   /// A flag indicating that the mesh has changed and the oversampled mesh needs to be re-initialized
   bool _oversample_mesh_changed;
 
+  /**
+   * Flag indicating that the source solution must be serialized to every processor. This is
+   * needed when the oversampled mesh is read from a file or once the source mesh has changed: only
+   * a clone or refinement of the current source mesh is partitioned like it and can get by with
+   * the ghosted source values.
+   */
+  bool _serialize_solution;
+
   std::unique_ptr<EquationSystems> _oversample_es;
   std::unique_ptr<MooseMesh> _cloned_mesh_ptr;
 
-  /// Oversample solution vector
+  /// Oversample solution vector (only used when _serialize_solution is set)
   /* Each of the MeshFunctions keeps a reference to this vector, the vector is updated for the
    * current system
    * and variable before the MeshFunction is applied. This allows for the same MeshFunction object
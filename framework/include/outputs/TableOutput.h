@@ -86,6 +86,9 @@ protected:
 
   /// Enable/disable output of time column for Postprocessors
   bool _time_column;
+
+  /// The number of rows kept in memory by the tables (zero keeps all rows)
+  const unsigned int _max_table_rows;
 };
 
 #endif /* TABLEOUTPUT_H */
@@ -19,6 +19,8 @@
 #include "MooseEnum.h"
 #include "MoosePartitioner.h"
 
+#include "libmesh/error_vector.h"
+
 class LibmeshPartitioner;
 class MooseMesh;
 
@@ -45,10 +47,22 @@ public:
 protected:
   virtual void _do_partition(MeshBase & mesh, const unsigned int n);
 
+  /**
+   * Attaches the element costs measured by the element loop scheduler of the mesh as weights to
+   * the partitioner.
+   */
+  void attachElementWorkWeights();
+
   std::unique_ptr<Partitioner> _partitioner;
   MooseEnum _partitioner_name;
   const std::vector<std::vector<SubdomainName>> & _subdomain_blocks;
   MooseMesh & _mesh;
+
+  /// Whether the elements are weighted by their measured cost
+  const bool _use_element_work_weights;
+
+  /// The element weights, indexed by element id
+  ErrorVector _work_weights;
 };
 
 #endif /* LIBMESHPARTITIONER_H */
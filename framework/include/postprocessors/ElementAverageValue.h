@@ -40,6 +40,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   Real _volume;
 };
 
@@ -46,6 +46,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   /// Get the extreme value at each quadrature point
   virtual void computeQpValue() override;
 
@@ -40,6 +40,8 @@ public:
   virtual Real getValue() override;
 
 protected:
+  virtual void addReductions() override;
+
   virtual Real computeQpIntegral() = 0;
   virtual Real computeIntegral();
 
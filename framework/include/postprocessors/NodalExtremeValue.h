@@ -46,6 +46,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   /// The extreme value type ("min" or "max")
   ExtremeType _type;
 
@@ -36,6 +36,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   Real _integral_value;
   Function & _func;
 };
@@ -39,6 +39,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   Real _sum_of_squares;
 };
 
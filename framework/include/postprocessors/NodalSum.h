@@ -38,6 +38,8 @@ public:
   void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   Real _sum;
 };
 
@@ -40,6 +40,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   virtual Real computeQpIntegral() = 0;
   virtual Real computeIntegral();
 
@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef VECTORPOSTPROCESSORCOMPONENT_H
+#define VECTORPOSTPROCESSORCOMPONENT_H
+
+#include "GeneralPostprocessor.h"
+
+class VectorPostprocessorComponent;
+
+template <>
+InputParameters validParams<VectorPostprocessorComponent>();
+
+/**
+ * Reports a single entry of a vector of a VectorPostprocessor
+ */
+class VectorPostprocessorComponent : public GeneralPostprocessor
+{
+public:
+  VectorPostprocessorComponent(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The vector holding the reported entry
+  const VectorPostprocessorValue & _vpp_values;
+
+  /// The index of the reported entry
+  const unsigned int _index;
+};
+
+#endif /* VECTORPOSTPROCESSORCOMPONENT_H */
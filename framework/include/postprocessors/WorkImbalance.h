@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef WORKIMBALANCE_H
+#define WORKIMBALANCE_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class WorkImbalance;
+
+template <>
+InputParameters validParams<WorkImbalance>();
+
+/**
+ * Reports the ratio of the largest to the average processor work, based on the element costs
+ * measured by the element loop scheduler.
+ */
+class WorkImbalance : public GeneralPostprocessor
+{
+public:
+  WorkImbalance(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+
+private:
+  enum class ImbalanceType
+  {
+    CURRENT,
+    BEFORE_REBALANCE,
+    AFTER_REBALANCE,
+  };
+  const ImbalanceType _type;
+};
+
+#endif // WORKIMBALANCE_H
@@ -15,12 +15,31 @@
 #ifndef BACKUP_H
 #define BACKUP_H
 
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
 // C++ includes
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
+// Forward declarations
+class MaterialPropertyStorage;
+
+// libMesh forward declarations
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
+
 /**
  * Helper class to hold streams for Backup and Restore operations.
+ *
+ * A Backup may alternatively hold in-memory copies of the system vectors and of the stateful
+ * material property storage (a "snapshot"), which are much cheaper to take and restore than the
+ * serialized _system_data and _restartable_data.
  */
 class Backup
 {
@@ -29,9 +48,59 @@ public:
 
   ~Backup();
 
+  /**
+   * In-memory copy of a restartable MaterialPropertyStorage
+   */
+  struct MaterialSnapshot
+  {
+    /// The thread of the restartable data the copy was taken from
+    unsigned int tid;
+
+    /// The name of the restartable data the copy was taken from
+    std::string name;
+
+    /// The context of the restartable data, needed to serialize the copy
+    void * context;
+
+    /// The copy of the property values
+    std::unique_ptr<MaterialPropertyStorage> storage;
+  };
+
+  /**
+   * Whether or not the system vectors are held in memory rather than in _system_data.
+   */
+  bool hasSystemSnapshot() const { return !_system_snapshot.empty(); }
+
+  /**
+   * Serializes the in-memory system vectors into _system_data (in the same layout as
+   * RestartableDataIO::serializeSystems()) and adds the in-memory material properties to
+   * _restartable_data, so that this Backup can be written out.
+   */
+  void serializeSnapshot();
+
+  /**
+   * Drops the in-memory copies so that _system_data and _restartable_data are used on restore.
+   * The snapshot must have been serialized first if this Backup is restored afterwards.
+   */
+  void clearSnapshot();
+
+  /**
+   * Number of bytes held by this Backup on the current processor
+   */
+  std::size_t memoryUsage();
+
   std::stringstream _system_data;
 
   std::vector<std::stringstream *> _restartable_data;
+
+  /// In-memory copies of the system vectors, in the order they are serialized in _system_data
+  std::vector<std::unique_ptr<libMesh::NumericVector<libMesh::Real>>> _system_snapshot;
+
+  /// In-memory copies of the material property storage, which are left out of _restartable_data
+  std::vector<MaterialSnapshot> _material_snapshot;
+
+  /// Whether or not _restartable_data already holds the in-memory material properties
+  bool _material_snapshot_serialized;
 };
 
 // Specializations for dataLoad and dataStore appear in DataIO.C
@@ -655,6 +655,9 @@ template <>
 inline void
 dataStore(std::ostream & stream, Backup *& backup, void * context)
 {
+  // In-memory snapshots are written in the serialized layout
+  backup->serializeSnapshot();
+
   dataStore(stream, backup->_system_data, context);
 
   for (unsigned int i = 0; i < backup->_restartable_data.size(); i++)
@@ -665,6 +668,8 @@ template <>
 inline void
 dataLoad(std::istream & stream, Backup *& backup, void * context)
 {
+  backup->clearSnapshot();
+
   dataLoad(stream, backup->_system_data, context);
 
   for (unsigned int i = 0; i < backup->_restartable_data.size(); i++)
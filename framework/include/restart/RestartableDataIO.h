@@ -65,6 +65,13 @@ public:
    */
   std::shared_ptr<Backup> createBackup();
 
+  /**
+   * Store the current system into an existing Backup, reusing its storage.  The system vectors
+   * and the stateful material properties are copied into in-memory copies held by the Backup;
+   * everything else is serialized as in createBackup().
+   */
+  void snapshot(Backup & backup);
+
   /**
    * Restore a Backup for the current system.
    */
@@ -96,6 +103,21 @@ private:
    */
   void deserializeSystems(std::istream & stream);
 
+  /**
+   * Copies the vectors of the Systems in FEProblemBase into the in-memory snapshot of the Backup
+   */
+  void snapshotSystems(Backup & backup);
+
+  /**
+   * Copies the in-memory snapshot of the Backup back into the vectors of the Systems
+   */
+  void restoreSystemSnapshot(const Backup & backup);
+
+  /**
+   * The vectors of the Systems in FEProblemBase in the order they are serialized
+   */
+  std::vector<NumericVector<Real> *> systemVectors();
+
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
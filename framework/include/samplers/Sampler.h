@@ -42,6 +42,10 @@ InputParameters validParams<Sampler>();
  * Samplers support the use of "execute_on", which when called results in new set of random numbers,
  * thus after execute() runs the getSamples() method will now produces a new set of random numbers
  * from calls prior to the execute() call.
+ *
+ * For large studies the getSampleRows() method provides a range of rows (e.g., the rows assigned to
+ * a processor) without building all of the matrices, if the child class supports it by overriding
+ * sampleRows(), sampleRowCounts() and sampleAdvance().
  */
 class Sampler : public MooseObject, public SetupInterface, public DistributionInterface
 {
@@ -127,6 +131,40 @@ public:
    */
   unsigned int getTotalNumberOfRows();
 
+  /**
+   * Return the number of DenseMatrix objects returned by getSamples().
+   */
+  unsigned int getNumberOfSamples();
+
+  /**
+   * Return the number of rows in a DenseMatrix returned by getSamples().
+   * @param sample The index of the DenseMatrix
+   */
+  unsigned int getNumberOfRows(unsigned int sample);
+
+  /**
+   * Return a range of rows of the sampled data. The rows are the same as the ones returned by
+   * getSamples(), but only the requested rows are computed when the child class supports it.
+   * @param begin The first global row (see getLocation())
+   * @param end One past the last global row
+   * @return A DenseMatrix with a row for each of the requested global rows
+   */
+  DenseMatrix<Real> getSampleRows(unsigned int begin, unsigned int end);
+
+  ///@{
+  /**
+   * The range [begin, end) of the global rows assigned to this processor, the rows are divided into
+   * contiguous blocks of (nearly) equal size.
+   */
+  unsigned int getLocalRowBegin();
+  unsigned int getLocalRowEnd();
+  ///@}
+
+  /**
+   * Return the rows assigned to this processor (see getSampleRows()).
+   */
+  DenseMatrix<Real> getLocalSamples();
+
 protected:
   /**
    * Get the next random number from the generator.
@@ -144,6 +182,36 @@ protected:
    */
   virtual std::vector<DenseMatrix<Real>> sample() = 0;
 
+  /**
+   * Compute the global rows [begin, end) of the data returned by sample(). The generator is in its
+   * saved state when this is called, so the rows prior to begin must be skipped with
+   * advanceRandom(). The default copies the rows from sample(), override it (along with
+   * sampleRowCounts() and sampleAdvance()) to only compute the requested rows.
+   * @param begin The first global row
+   * @param end One past the last global row
+   * @param rows The computed rows, sized by this method
+   */
+  virtual void sampleRows(unsigned int begin, unsigned int end, DenseMatrix<Real> & rows);
+
+  /**
+   * Return the number of rows for each of the DenseMatrix objects returned by sample(). The default
+   * calls sample().
+   */
+  virtual std::vector<unsigned int> sampleRowCounts();
+
+  /**
+   * Advance the generator past all of the data, i.e., to the state after a call to sample(). This
+   * is used by execute() to create new random numbers. The default calls sample().
+   */
+  virtual void sampleAdvance();
+
+  /**
+   * Discard random numbers from the generator.
+   * @param count The number of random numbers to skip
+   * @param index The index of the seed
+   */
+  void advanceRandom(std::size_t count, unsigned int index = 0);
+
   /**
    * Set the number of seeds required by the sampler. The Sampler will generate
    * additional seeds as needed. This function should be called in the constructor
@@ -158,6 +226,12 @@ protected:
    */
   void reinit(const std::vector<DenseMatrix<Real>> & data);
 
+  /**
+   * Reinitialize the offsets and row counts.
+   * @param row_counts The number of rows in each DenseMatrix, as returned by sampleRowCounts()
+   */
+  void reinit(const std::vector<unsigned int> & row_counts);
+
   /// Map used to store the perturbed parameters and their corresponding distributions
   std::vector<Distribution *> _distributions;
 
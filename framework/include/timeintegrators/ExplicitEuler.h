@@ -15,7 +15,7 @@
 #ifndef EXPLICITEULER_H
 #define EXPLICITEULER_H
 
-#include "TimeIntegrator.h"
+#include "ExplicitTimeIntegrator.h"
 
 class ExplicitEuler;
 
@@ -25,13 +25,12 @@ InputParameters validParams<ExplicitEuler>();
 /**
  * Explicit Euler time integrator
  */
-class ExplicitEuler : public TimeIntegrator
+class ExplicitEuler : public ExplicitTimeIntegrator
 {
 public:
   ExplicitEuler(const InputParameters & parameters);
   virtual ~ExplicitEuler();
 
-  virtual void preSolve();
   virtual int order() { return 1; }
   virtual void computeTimeDerivatives();
   virtual void postStep(NumericVector<Number> & residual);
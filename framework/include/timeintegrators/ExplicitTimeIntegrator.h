@@ -0,0 +1,113 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EXPLICITTIMEINTEGRATOR_H
+#define EXPLICITTIMEINTEGRATOR_H
+
+#include "TimeIntegrator.h"
+#include "MooseEnum.h"
+
+class ExplicitTimeIntegrator;
+
+template <>
+InputParameters validParams<ExplicitTimeIntegrator>();
+
+/**
+ * Base class for the explicit time integrators.
+ *
+ * With solve_type = consistent each stage is solved with the nonlinear
+ * solver, which amounts to a linear solve with the mass matrix.
+ *
+ * With solve_type = lumped the mass matrix is replaced by its row sums and
+ * each stage is computed directly from a single residual evaluation, without
+ * assembling a Jacobian or calling the linear solver. Since the stage
+ * residuals are linear in the solution when the non-time kernels are marked
+ * "implicit=false", the row sums of the stage Jacobian are obtained from the
+ * difference of two residual evaluations, R(u + 1) - R(u), which also gives
+ * the correct (unit) diagonal for nodal BCs. This is only recomputed when the
+ * time step size or the number of dofs changes.
+ */
+class ExplicitTimeIntegrator : public TimeIntegrator
+{
+public:
+  ExplicitTimeIntegrator(const InputParameters & parameters);
+
+  virtual void preSolve() override;
+  virtual void solve() override;
+
+  virtual bool overridesSolve() const override { return _solve_type == LUMPED; }
+
+  /**
+   * Each lumped stage is a single update, which is reported as one nonlinear iteration without
+   * linear iterations
+   */
+  virtual unsigned int getNumNonlinearIterations() const override { return 1; }
+  virtual unsigned int getNumLinearIterations() const override { return 0; }
+
+  /**
+   * The l2 norm of the stage residual the last lumped update was computed from
+   */
+  virtual Real getFinalNonlinearResidual() const override { return _lumped_residual_norm; }
+
+protected:
+  /**
+   * Solve for the solution of the current stage, using either the nonlinear
+   * solver or the lumped mass matrix depending on solve_type
+   */
+  void solveStage();
+
+  /**
+   * Compute the inverse of the row sums of the stage Jacobian and the residual
+   * at the current solution, which is left in _explicit_residual
+   */
+  void computeLumpedJacobianInverse();
+
+  /**
+   * Error out if any non-time residual object is implicit, since the lumped update assumes that
+   * the stage residuals are linear in the solution
+   */
+  void checkLumpedSolveObjects();
+
+  enum SolveType
+  {
+    CONSISTENT,
+    LUMPED
+  };
+
+  /// How the stages are solved
+  const SolveType _solve_type;
+
+  /// Residual of the current stage
+  NumericVector<Number> & _explicit_residual;
+
+  /// Solution update of the current stage
+  NumericVector<Number> & _explicit_update;
+
+  /// Inverse of the row sums of the stage Jacobian
+  NumericVector<Number> & _lumped_jacobian_inverse;
+
+  /// Whether _lumped_jacobian_inverse needs to be recomputed
+  bool _recompute_lumped_jacobian;
+
+  /// Number of dofs when _lumped_jacobian_inverse was last computed
+  dof_id_type _lumped_n_dofs;
+
+  /// Whether checkLumpedSolveObjects() has been called
+  bool _lumped_objects_checked;
+
+  /// l2 norm of the residual of the last lumped stage
+  Real _lumped_residual_norm;
+};
+
+#endif /* EXPLICITTIMEINTEGRATOR_H */
@@ -77,6 +77,27 @@ public:
   virtual int order() = 0;
   virtual void computeTimeDerivatives() = 0;
 
+  /**
+   * Whether the last time step was solved by the TimeIntegrator itself instead of the nonlinear
+   * solver, in which case the solve statistics are taken from the methods below
+   */
+  virtual bool overridesSolve() const { return false; }
+
+  /**
+   * Return the number of nonlinear iterations of the last time step, when overridesSolve() is true
+   */
+  virtual unsigned int getNumNonlinearIterations() const { return 0; }
+
+  /**
+   * Return the number of linear iterations of the last time step, when overridesSolve() is true
+   */
+  virtual unsigned int getNumLinearIterations() const { return 0; }
+
+  /**
+   * Return the final nonlinear residual of the last time step, when overridesSolve() is true
+   */
+  virtual Real getFinalNonlinearResidual() const { return 0.; }
+
 protected:
   FEProblemBase & _fe_problem;
   SystemBase & _sys;
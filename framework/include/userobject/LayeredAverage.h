@@ -38,6 +38,8 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  virtual void addReductions() override;
+
   /// Value of the volume for each layer
   std::vector<Real> _layer_volumes;
 };
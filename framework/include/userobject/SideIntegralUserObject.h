@@ -44,6 +44,8 @@ public:
   virtual Real getValue();
 
 protected:
+  virtual void addReductions() override;
+
   virtual Real computeQpIntegral() = 0;
   virtual Real computeIntegral();
 
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "GeneralUserObject.h"
+#include "MemoryUsageReporterInterface.h"
 
 // Forward declarations
 namespace libMesh
@@ -39,7 +40,7 @@ InputParameters validParams<SolutionUserObject>();
  * User object that reads an existing solution from an input file and
  * uses it in the current simulation.
  */
-class SolutionUserObject : public GeneralUserObject
+class SolutionUserObject : public GeneralUserObject, public MemoryUsageReporterInterface
 {
 public:
   SolutionUserObject(const InputParameters & parameters);
@@ -227,6 +228,12 @@ public:
    */
   unsigned int getMeshFileDimension() const { return _mesh->spatial_dimension(); }
 
+  /**
+   * Reports an estimate of the bytes held by the mesh and the serialized solutions that were read
+   * in the "solution_user_objects" category
+   */
+  virtual void reportMemoryUsage(std::map<std::string, std::size_t> & bytes) const override;
+
 protected:
   /**
    * Method for reading XDA mesh and equation systems file(s)
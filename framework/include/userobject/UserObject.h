@@ -21,6 +21,7 @@
 #include "MeshChangedInterface.h"
 #include "MooseObject.h"
 #include "MooseTypes.h"
+#include "ReductionAggregator.h"
 #include "Restartable.h"
 #include "ScalarCoupleable.h"
 #include "SetupInterface.h"
@@ -109,28 +110,45 @@ public:
    */
   virtual void threadJoin(const UserObject & uo) = 0;
 
+  /**
+   * Register the partial values this object gathers across processors with the given aggregator,
+   * which reduces them together with those of the other user objects finalized at the same time.
+   * This is called after threadJoin() and before finalize().
+   */
+  void registerReductions(ReductionAggregator & reductions);
+
+  /**
+   * Forget the values registered by registerReductions() so that gathering them communicates
+   * again. This is called after finalize().
+   */
+  void clearReductions() { _deferred_values.clear(); }
+
   /**
    * Gather the parallel sum of the variable passed in. It takes care of values across all threads
    * and CPUs (we DO hybrid parallelism!)
    *
-   * After calling this, the variable that was passed in will hold the gathered value.
+   * After calling this, the variable that was passed in will hold the gathered value. Values
+   * registered with deferSum() have already been gathered and are left untouched.
    */
   template <typename T>
   void gatherSum(T & value)
   {
-    _communicator.sum(value);
+    if (!isDeferred(&value))
+      _communicator.sum(value);
   }
 
   template <typename T>
   void gatherMax(T & value)
   {
-    _communicator.max(value);
+    if (!isDeferred(&value))
+      _communicator.max(value);
   }
 
   template <typename T>
   void gatherMin(T & value)
   {
-    _communicator.min(value);
+    if (!isDeferred(&value))
+      _communicator.min(value);
   }
 
   template <typename T1, typename T2>
@@ -142,6 +160,26 @@ public:
   }
 
 protected:
+  /**
+   * Override to register, with deferSum(), deferMax() and deferMin(), the values that are later
+   * passed to gatherSum(), gatherMax() and gatherMin(). Overrides must call the parent class
+   * method.
+   */
+  virtual void addReductions() {}
+
+  ///@{
+  /**
+   * Register a Real or std::vector<Real> value for the aggregated reduction. Only callable from
+   * addReductions().
+   */
+  template <typename T>
+  void deferSum(T & value);
+  template <typename T>
+  void deferMax(T & value);
+  template <typename T>
+  void deferMin(T & value);
+  ///@}
+
   /// Reference to the Subproblem for this user object
   SubProblem & _subproblem;
 
@@ -156,6 +194,43 @@ protected:
   const Moose::CoordinateSystemType & _coord_sys;
 
   const bool _duplicate_initial_execution;
+
+private:
+  /// Whether the value at this address was registered for the aggregated reduction
+  bool isDeferred(const void * value) const;
+
+  /// The aggregator while addReductions() is called
+  ReductionAggregator * _reductions;
+
+  /// Addresses of the values registered for the aggregated reduction
+  std::vector<const void *> _deferred_values;
 };
 
+template <typename T>
+void
+UserObject::deferSum(T & value)
+{
+  mooseAssert(_reductions, "deferSum() may only be called from addReductions()");
+  _reductions->sum(value);
+  _deferred_values.push_back(&value);
+}
+
+template <typename T>
+void
+UserObject::deferMax(T & value)
+{
+  mooseAssert(_reductions, "deferMax() may only be called from addReductions()");
+  _reductions->max(value);
+  _deferred_values.push_back(&value);
+}
+
+template <typename T>
+void
+UserObject::deferMin(T & value)
+{
+  mooseAssert(_reductions, "deferMin() may only be called from addReductions()");
+  _reductions->min(value);
+  _deferred_values.push_back(&value);
+}
+
 #endif /* USEROBJECT_H */
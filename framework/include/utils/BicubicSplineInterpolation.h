@@ -57,11 +57,17 @@ public:
 
   void errorCheck();
 
-  Real sample(Real x1, Real x2, Real yx11 = _deriv_bound, Real yx1n = _deriv_bound);
-  Real sampleDerivative(
-      Real x1, Real x2, unsigned int deriv_var, Real yp1 = _deriv_bound, Real ypn = _deriv_bound);
-  Real sample2ndDerivative(
-      Real x1, Real x2, unsigned int deriv_var, Real yp1 = _deriv_bound, Real ypn = _deriv_bound);
+  Real sample(Real x1, Real x2, Real yx11 = _deriv_bound, Real yx1n = _deriv_bound) const;
+  Real sampleDerivative(Real x1,
+                        Real x2,
+                        unsigned int deriv_var,
+                        Real yp1 = _deriv_bound,
+                        Real ypn = _deriv_bound) const;
+  Real sample2ndDerivative(Real x1,
+                           Real x2,
+                           unsigned int deriv_var,
+                           Real yp1 = _deriv_bound,
+                           Real ypn = _deriv_bound) const;
 
 protected:
   std::vector<Real> _x1;
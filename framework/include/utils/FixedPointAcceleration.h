@@ -0,0 +1,96 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FIXEDPOINTACCELERATION_H
+#define FIXEDPOINTACCELERATION_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel_object.h"
+
+#include <deque>
+
+/**
+ * Computes the next iterate of a fixed point iteration x = G(x), such as the Picard iterations
+ * between MultiApps, from the input x and the output G(x) of the last iteration.
+ *
+ * The supported methods are
+ *   - relaxation: x_{k+1} = x_k + w r_k, with the residual r_k = G(x_k) - x_k
+ *   - Aitken: relaxation with a factor updated from the last two residuals
+ *   - Anderson: the combination of the last iterates that minimizes the residual in the least
+ *     squares sense, relaxed by w; a history of one iterate gives the secant method
+ *
+ * The values may either be distributed, each processor holding a part of them, or replicated on
+ * all processors.
+ */
+class FixedPointAcceleration : public libMesh::ParallelObject
+{
+public:
+  enum Method
+  {
+    RELAXATION,
+    AITKEN,
+    ANDERSON
+  };
+
+  /**
+   * @param comm The communicator the values are distributed or replicated on
+   * @param distributed Whether each processor holds a part of the values
+   * @param method The acceleration method
+   * @param relaxation_factor The relaxation factor w, for Aitken only used in the first iteration
+   * @param history The number of previous iterates used by the Anderson method
+   */
+  FixedPointAcceleration(const libMesh::Parallel::Communicator & comm,
+                         bool distributed,
+                         Method method,
+                         Real relaxation_factor,
+                         unsigned int history);
+
+  /**
+   * Forget the previous iterates, to be called when a new fixed point iteration begins
+   */
+  void reset();
+
+  /**
+   * Compute the next iterate.
+   * @param x The input of the last iteration, replaced by the next iterate
+   * @param g The output of the last iteration
+   */
+  void update(std::vector<Real> & x, const std::vector<Real> & g);
+
+protected:
+  /// The dot product of the values on all processors
+  Real dot(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
+  /// Solve the Anderson least squares problem for the weights of the previous iterates
+  std::vector<Real> andersonWeights(const std::vector<Real> & residual);
+
+  const bool _distributed;
+  const Method _method;
+  const Real _relaxation_factor;
+  const unsigned int _history;
+
+  /// Residual and output of the last iteration, empty at the beginning
+  std::vector<Real> _last_residual;
+  std::vector<Real> _last_output;
+
+  /// Differences of the residuals and outputs of successive iterations, most recent last
+  std::deque<std::vector<Real>> _residual_differences;
+  std::deque<std::vector<Real>> _output_differences;
+
+  /// The current Aitken relaxation factor
+  Real _aitken_factor;
+};
+
+#endif // FIXEDPOINTACCELERATION_H
@@ -22,6 +22,7 @@
 
 // C++ includes
 #include <fstream>
+#include <unordered_map>
 
 // Forward declarations
 class FormattedTable;
@@ -37,6 +38,11 @@ void dataLoad(std::istream & stream, FormattedTable & v, void * context);
 
 /**
  * This class is used for building, formatting, and outputting tables of numbers.
+ *
+ * The data is stored by column, each column name is assigned an integer id when it is first added.
+ * By default all rows are kept in memory, setRowWindow() limits the number of rows that are kept
+ * in memory for long running simulations. Rows are only discarded after they have been written by
+ * printCSV() (if it is used), so the CSV file always contains all rows.
  */
 class FormattedTable
 {
@@ -89,13 +95,22 @@ public:
 
   void clear();
 
+  /**
+   * Set the number of rows that are kept in memory, older rows are discarded. A value of zero
+   * keeps all rows. When keep_unwritten is true (or once printCSV() has been called) rows are
+   * only discarded after being written to the file.
+   */
+  void setRowWindow(std::size_t row_window, bool keep_unwritten = false)
+  {
+    _row_window = row_window;
+    _keep_unwritten = keep_unwritten;
+  }
+
   /**
    * Set whether or not to output time column.
    */
   void outputTimeColumn(bool output_time) { _output_time = output_time; }
 
-  //  const std::map<Real, std::map<std::string, Real>> & getData() const { return _data; }
-
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
    * a filename is supplied opening and closing of the file is properly handled.  In the
@@ -167,12 +182,30 @@ protected:
   unsigned short getTermWidth(bool use_environment) const;
 
   /**
-   * Data structure for the console table:
-   * The first part of the pair tracks the independent variable (normally time) and is associated
-   * with the second part of the table which is the map of dependent variables and their associated
-   * values.
+   * Returns the id of a column, the column is created (with zero values for the existing rows) if
+   * it does not exist.
+   */
+  unsigned int getColumnId(const std::string & name);
+
+  /**
+   * Appends a row with zero values and discards the old rows that are outside of the window.
    */
-  std::vector<std::pair<Real, std::map<std::string, Real>>> _data;
+  void addRow(Real time);
+
+  /// The independent variable (normally time) for each row in memory
+  std::vector<Real> _times;
+
+  /// The dependent variables for each row in memory, one contiguous vector per column (by id)
+  std::vector<std::vector<Real>> _columns;
+
+  /// The id of each column name
+  std::unordered_map<std::string, unsigned int> _column_ids;
+
+  /// The global index of the first row in memory (non-zero when rows have been discarded)
+  std::size_t _first_row;
+
+  /// The number of rows kept in memory (zero keeps all rows)
+  std::size_t _row_window;
 
   /// Alignment widths (only used if asked to print aligned to CSV output)
   std::map<std::string, unsigned int> _align_widths;
@@ -193,7 +226,8 @@ private:
   /// Open or switch the underlying file stream to point to file_name. This is idempotent.
   void open(const std::string & file_name);
 
-  void printRow(std::pair<Real, std::map<std::string, Real>> & row_data, bool align);
+  /// Write a row (index of the rows in memory) to the CSV file
+  void printRow(std::size_t row, bool align);
 
   /// The optional output file stream
   std::string _output_file_name;
@@ -210,6 +244,9 @@ private:
   /// Keeps track of whether the current stream is open or not.
   bool _stream_open;
 
+  /// When true rows are only discarded after being written by printCSV()
+  bool _keep_unwritten;
+
   /// Keeps track of whether we want to open an existing file for appending or overwriting.
   bool _append;
 
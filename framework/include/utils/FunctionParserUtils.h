@@ -18,6 +18,7 @@
 #include "Moose.h"
 
 #include "libmesh/fparser_ad.hh"
+#include "libmesh/parallel.h"
 
 // C++ includes
 #include <memory>
@@ -46,6 +47,16 @@ public:
   /// apply input paramters to internal feature flags of the parser object
   void setParserFeatureFlags(ADFunctionPtr &);
 
+  /**
+   * Just-in-time compile the parser. The compiled objects are cached on disk keyed by a hash of
+   * the expression, so the first processor compiles while the others wait and then load the
+   * cached object instead of all invoking the compiler at once.
+   * @param parser The parser to compile
+   * @param comm The communicator of all processors compiling the same expression
+   * @return Whether or not the compilation succeeded
+   */
+  static bool jitCompile(ADFunctionPtr & parser, const Parallel::Communicator & comm);
+
 protected:
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunctionPtr &);
@@ -31,6 +31,15 @@ public:
                       unsigned int patch_size,
                       std::vector<std::size_t> & return_index);
 
+  /**
+   * Find the (at most) patch_size points closest to the query point and return their indices and
+   * squared distances sorted by distance.
+   */
+  void neighborSearch(const Point & query_point,
+                      unsigned int patch_size,
+                      std::vector<std::size_t> & return_index,
+                      std::vector<Real> & return_dist_sqr) const;
+
   /**
    * PointListAdaptor is required to use libMesh Point coordinate type with
    * nanoflann KDTree library. The member functions within the PointListAdaptor
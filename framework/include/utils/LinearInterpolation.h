@@ -53,6 +53,14 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Sample the fit starting the search for the interval containing x from a previous one. This
+   * is faster than sample(x) when consecutive samples are close to each other.
+   * @param x The independent variable
+   * @param interval The interval to start searching from, set to the interval containing x
+   */
+  Real sample(Real x, unsigned int & interval) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the
    * dependent variable
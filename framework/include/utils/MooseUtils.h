@@ -398,6 +398,19 @@ tokenizeAndConvert(const std::string & str,
  */
 std::string toUpper(const std::string & name);
 
+/**
+ * Find the interval [x[i], x[i+1]) of strictly increasing data that contains a value, starting
+ * the search from a previously found interval. The search takes O(log d) steps where d is the
+ * distance from the guess, so it is cheaper than a full bisection when consecutive values are
+ * close together. Values outside of the data give the first or the last interval.
+ * @param x The strictly increasing data (at least two entries)
+ * @param value The value to bracket
+ * @param guess The lower index of the interval to start from (e.g. the result of the last search)
+ * @return The lower index of the interval, in [0, x.size() - 2]
+ */
+unsigned int
+huntInterval(const std::vector<libMesh::Real> & x, libMesh::Real value, unsigned int guess = 0);
+
 /**
  * Returns a container that contains the content of second passed in container
  * inserted into the first passed in container (set or map union).
@@ -121,6 +121,16 @@ void colorAdjacencyMatrix(PetscScalar * adjacency_matrix,
                           unsigned int colors,
                           std::vector<unsigned int> & vertex_colors,
                           const char * coloring_algorithm);
+
+/**
+ * This method is identical to colorAdjacencyMatrix() but takes a sparse adjacency graph, i.e. the
+ * sorted list of neighbors for each vertex, to avoid the storage of a dense matrix for large
+ * graphs.
+ */
+void colorAdjacencyGraph(const std::vector<std::vector<unsigned int>> & adjacency_graph,
+                         unsigned int colors,
+                         std::vector<unsigned int> & vertex_colors,
+                         const char * coloring_algorithm);
 }
 }
 
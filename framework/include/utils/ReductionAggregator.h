@@ -0,0 +1,85 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef REDUCTIONAGGREGATOR_H
+#define REDUCTIONAGGREGATOR_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel_object.h"
+
+/**
+ * Collects values that need to be summed, maximized or minimized across processors and reduces
+ * all values that share an operation with a single packed communication. This replaces one
+ * allreduce per value with at most three allreduce calls per group of values.
+ *
+ * Every processor must register the same values, in the same order, and vectors of the same
+ * length, before calling reduce().
+ */
+class ReductionAggregator : public libMesh::ParallelObject
+{
+public:
+  ReductionAggregator(const libMesh::Parallel::Communicator & comm);
+
+  ///@{
+  /**
+   * Register a value to be reduced by the next call to reduce(). The value must stay alive until
+   * then, after which it holds the reduced result.
+   */
+  void sum(Real & value);
+  void sum(std::vector<Real> & values);
+  void max(Real & value);
+  void max(std::vector<Real> & values);
+  void min(Real & value);
+  void min(std::vector<Real> & values);
+  ///@}
+
+  /**
+   * Reduce all registered values, one communication per operation, and clear the registrations.
+   */
+  void reduce();
+
+  /// Total number of values reduced so far
+  unsigned long int numReducedValues() const { return _num_reduced_values; }
+
+  /// Total number of communications performed so far
+  unsigned long int numCommunications() const { return _num_communications; }
+
+protected:
+  /// The values registered for one reduction operation
+  struct Operation
+  {
+    std::vector<Real *> scalars;
+    std::vector<std::vector<Real> *> vectors;
+  };
+
+  /**
+   * Pack the values of an operation, reduce them with the given communication and scatter the
+   * results back.
+   */
+  template <typename Communication>
+  void reduce(Operation & operation, Communication communication);
+
+  Operation _sum;
+  Operation _max;
+  Operation _min;
+
+  /// Scratch buffer holding the packed values
+  std::vector<Real> _buffer;
+
+  unsigned long int _num_reduced_values;
+  unsigned long int _num_communications;
+};
+
+#endif // REDUCTIONAGGREGATOR_H
@@ -47,12 +47,22 @@ protected:
               const std::vector<Real> & y,
               std::vector<Real> & y2,
               Real yp1 = _deriv_bound,
-              Real ypn = _deriv_bound);
+              Real ypn = _deriv_bound) const;
 
   void findInterval(const std::vector<Real> & x,
                     Real x_int,
                     unsigned int & klo,
                     unsigned int & khi) const;
+  /**
+   * Sample the spline in a known interval [x[klo], x[khi]]
+   */
+  Real sampleInterval(const std::vector<Real> & x,
+                      const std::vector<Real> & y,
+                      const std::vector<Real> & y2,
+                      Real x_int,
+                      unsigned int klo,
+                      unsigned int khi) const;
+
   void computeCoeffs(const std::vector<Real> & x,
                      unsigned int klo,
                      unsigned int khi,
@@ -0,0 +1,68 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MEMORYUSAGEBREAKDOWN_H
+#define MEMORYUSAGEBREAKDOWN_H
+
+#include "GeneralVectorPostprocessor.h"
+
+// Forward Declarations
+class MemoryUsageBreakdown;
+class GeometricSearchData;
+
+template <>
+InputParameters validParams<MemoryUsageBreakdown>();
+
+/**
+ * Reports the bytes held by the major data structures of the simulation on every processor,
+ * grouped by category. Objects implementing MemoryUsageReporterInterface contribute their own
+ * categories.
+ */
+class MemoryUsageBreakdown : public GeneralVectorPostprocessor
+{
+public:
+  MemoryUsageBreakdown(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  /// The categories reported as vectors, in the order they are printed
+  static const std::vector<std::string> categories;
+
+protected:
+  /**
+   * Adds the bytes held by the penetration locators of the given search data
+   */
+  void addGeometricSearch(const GeometricSearchData & geom_search_data);
+
+  /**
+   * Prints the min, max, average, and total of each category over all processors
+   */
+  void printTable() const;
+
+  /// Whether or not to print the summary table to the console
+  const bool _print_table;
+
+  /// The processor ids
+  VectorPostprocessorValue & _rank;
+
+  /// Bytes held by each processor, in the order of the categories
+  std::vector<VectorPostprocessorValue *> _category_bytes;
+
+  /// Bytes held by this processor for each category
+  std::map<std::string, std::size_t> _local_bytes;
+};
+
+#endif // MEMORYUSAGEBREAKDOWN_H
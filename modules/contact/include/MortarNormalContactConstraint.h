@@ -0,0 +1,61 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef MORTARNORMALCONTACTCONSTRAINT_H
+#define MORTARNORMALCONTACTCONSTRAINT_H
+
+// MOOSE includes
+#include "FaceFaceConstraint.h"
+
+// Forward Declarations
+class MortarNormalContactConstraint;
+
+template <>
+InputParameters validParams<MortarNormalContactConstraint>();
+
+/**
+ * Frictionless contact enforced with a Lagrange multiplier on a mortar interface. The Lagrange
+ * multiplier is the contact pressure; the Karush-Kuhn-Tucker conditions on it and on the normal
+ * gap are enforced with the semismooth nonlinear complementarity function
+ *   C(lambda, gap) = lambda - max(0, lambda - c * gap) = 0.
+ * One constraint acts on each displacement component (master_variable). Only the one for the
+ * first component assembles the Lagrange multiplier residual, the others only add the contact
+ * force and their part of the gap derivative.
+ */
+class MortarNormalContactConstraint : public FaceFaceConstraint
+{
+public:
+  MortarNormalContactConstraint(const InputParameters & parameters);
+
+  virtual void reinit() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpResidualSide(Moose::ConstraintType res_type) override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpJacobianSide(Moose::ConstraintJacobianType jac_type) override;
+
+  /// The displacement component this constraint acts on
+  const unsigned int _component;
+
+  /// Scaling of the gap in the complementarity function
+  const Real _c;
+
+  /// Normal of the slave surface (pointing towards the master surface) in the quadrature points
+  std::vector<RealVectorValue> _normals;
+
+  /// Normal gap between the master and the slave surface in the quadrature points
+  std::vector<Real> _gap;
+
+  /// Whether the quadrature point was projected onto both surfaces
+  std::vector<bool> _has_info;
+
+  /// Whether the quadrature point is in contact (the active branch of the complementarity function)
+  std::vector<bool> _active;
+};
+
+#endif /* MORTARNORMALCONTACTCONSTRAINT_H */
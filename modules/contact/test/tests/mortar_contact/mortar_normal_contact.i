@@ -0,0 +1,130 @@
+# Two blocks pushed together and pulled apart along y, with the contact pressure on the interface
+# between them enforced as a Lagrange multiplier on a mortar interface. Each displacement component
+# obeys a Laplace equation, so the solution is piecewise linear and known exactly: in the first step
+# the blocks are in contact and compressed uniformly, in the second one the top block is lifted off
+# the bottom one, which stays undeformed.
+[Mesh]
+  file = 2blk-conf.e
+  displacements = 'disp_x disp_y'
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./top_disp_y]
+    type = ParsedFunction
+    value = '0.01 * (2 * t - 3)'
+  [../]
+  [./exact_disp_y]
+    type = ParsedFunction
+    value = 'if(t < 1.5, -0.01 * y, if(y > 0.5, 0.01, 0))'
+  [../]
+  [./zero]
+    type = ConstantFunction
+    value = 0
+  [../]
+[]
+
+[Variables]
+  [./disp_x]
+    block = '1 2'
+  [../]
+  [./disp_y]
+    block = '1 2'
+  [../]
+  [./lm]
+    block = middle
+  [../]
+[]
+
+[Kernels]
+  [./diff_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./diff_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Constraints]
+  [./contact_x]
+    type = MortarNormalContactConstraint
+    variable = lm
+    interface = middle
+    master_variable = disp_x
+    component = 0
+  [../]
+  [./contact_y]
+    type = MortarNormalContactConstraint
+    variable = lm
+    interface = middle
+    master_variable = disp_y
+    component = 1
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 4
+    value = 0
+  [../]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+  [./top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 3
+    function = top_disp_y
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error_x]
+    type = ElementL2Error
+    variable = disp_x
+    function = zero
+    block = '1 2'
+  [../]
+  [./l2_error_y]
+    type = ElementL2Error
+    variable = disp_y
+    function = exact_disp_y
+    block = '1 2'
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_factor_shift_type'
+  petsc_options_value = 'lu       NONZERO'
+  num_steps = 2
+  dt = 1
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,113 @@
+# The problem of mortar_normal_contact.i solved with the node-to-segment MechanicalContactConstraint
+# (kinematic enforcement) instead of the mortar constraint, for the performance comparison in
+# speedtests. The mortar subdomain of the mesh is not used.
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  file = 2blk-conf.e
+[]
+
+[Functions]
+  [./top_disp_y]
+    type = ParsedFunction
+    value = '0.01 * (2 * t - 3)'
+  [../]
+  [./exact_disp_y]
+    type = ParsedFunction
+    value = 'if(t < 1.5, -0.01 * y, if(y > 0.5, 0.01, 0))'
+  [../]
+  [./zero]
+    type = ConstantFunction
+    value = 0
+  [../]
+[]
+
+[Variables]
+  [./disp_x]
+    block = '1 2'
+  [../]
+  [./disp_y]
+    block = '1 2'
+  [../]
+[]
+
+[Kernels]
+  [./diff_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./diff_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Contact]
+  [./middle]
+    master = 100
+    slave = 101
+    system = Constraint
+    formulation = kinematic
+    penalty = 1e4
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 4
+    value = 0
+  [../]
+  [./bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+  [./top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 3
+    function = top_disp_y
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error_x]
+    type = ElementL2Error
+    variable = disp_x
+    function = zero
+    block = '1 2'
+  [../]
+  [./l2_error_y]
+    type = ElementL2Error
+    variable = disp_y
+    function = exact_disp_y
+    block = '1 2'
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_factor_shift_type'
+  petsc_options_value = 'lu       NONZERO'
+  num_steps = 2
+  dt = 1
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
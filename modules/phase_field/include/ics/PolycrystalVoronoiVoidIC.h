@@ -10,6 +10,7 @@
 #include "MultiSmoothCircleIC.h"
 #include "MooseRandom.h"
 #include "PolycrystalICTools.h"
+#include "PeriodicKDTree.h"
 
 // Forward Declarationsc
 class PolycrystalVoronoiVoidIC;
@@ -52,18 +53,8 @@ protected:
   std::vector<Point> _centerpoints;
   std::vector<unsigned int> _assigned_op;
 
-  /// Type for distance and point
-  struct DistancePoint
-  {
-    Real d;
-    unsigned int gr;
-  };
-
-  /// Sorts the temp_centerpoints into order of magnitude
-  struct DistancePointComparator
-  {
-    bool operator()(const DistancePoint & a, const DistancePoint & b) { return a.d < b.d; }
-  } _customLess;
+  /// Spatial index for the closest grain center queries
+  std::unique_ptr<PeriodicKDTree> _center_tree;
 };
 
 #endif // POLYCRYSTALVORONOIVOIDIC_H
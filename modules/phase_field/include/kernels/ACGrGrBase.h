@@ -11,6 +11,7 @@
 
 // Forward Declarations
 class ACGrGrBase;
+class GrainTrackerInterface;
 
 template <>
 InputParameters validParams<ACGrGrBase>();
@@ -19,19 +20,46 @@ InputParameters validParams<ACGrGrBase>();
  * This is the base class for kernels that calculate the residual for grain growth.
  * It calculates the residual of the ith order parameter, and the values of
  * all other order parameters are coupled variables and are stored in vals.
+ *
+ * If a GrainTracker is supplied only the order parameters that are active on the current element
+ * (see activeOps()) are considered, the other order parameters are treated as zero.
  */
 class ACGrGrBase : public ACBulk<Real>
 {
 public:
   ACGrGrBase(const InputParameters & parameters);
 
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
+  /**
+   * Returns the indices (into _vals) of the coupled order parameters that are active on the
+   * current element, all indices when no GrainTracker is supplied.
+   */
+  const std::vector<unsigned int> & activeOps();
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
 
   const MaterialProperty<Real> & _mu;
+
+  /// GrainTracker providing the active order parameters on each element (optional)
+  const GrainTrackerInterface * _grain_tracker;
+
+private:
+  /// Index into _vals for each variable of the GrainTracker (invalid for other variables)
+  std::vector<unsigned int> _tracker_var_to_op;
+
+  /// All indices into _vals
+  std::vector<unsigned int> _all_ops;
+
+  /// The active indices into _vals for the element in _active_ops_elem
+  std::vector<unsigned int> _active_ops;
+  const Elem * _active_ops_elem;
 };
 
 #endif // ACGRGRBASE_H
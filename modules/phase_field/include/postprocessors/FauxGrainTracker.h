@@ -39,6 +39,7 @@ public:
                               std::size_t var_idx) const override;
   virtual const std::vector<unsigned int> &
   getVarToFeatureVector(dof_id_type elem_id) const override;
+  virtual const std::vector<unsigned int> & getActiveVars(dof_id_type elem_id) const override;
   virtual unsigned int getFeatureVar(unsigned int feature_id) const override;
   virtual std::size_t getNumberActiveGrains() const override;
   virtual std::size_t getTotalFeatureCount() const override;
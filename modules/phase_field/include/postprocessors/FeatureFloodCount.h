@@ -70,6 +70,13 @@ public:
    */
   virtual const std::vector<unsigned int> & getVarToFeatureVector(dof_id_type elem_id) const;
 
+  /**
+   * Returns the sorted indices of the variables that are active on a particular element, i.e.
+   * variables with a feature or the halo of a feature on the element. The remaining variables are
+   * (nearly) zero at that location. All variables are returned for unknown elements.
+   */
+  virtual const std::vector<unsigned int> & getActiveVars(dof_id_type elem_id) const;
+
   /// Returns the variable representing the passed in feature
   virtual unsigned int getFeatureVar(unsigned int feature_id) const;
 
@@ -297,6 +304,12 @@ protected:
    */
   virtual void updateFieldInfo();
 
+  /**
+   * Adds the variable of the feature to the active variables of the entities in the feature and
+   * its halo (see getActiveVars()).
+   */
+  void updateActiveVars(const FeatureData & feature);
+
   /**
    * This method will "mark" all entities on neighboring elements that
    * are above the supplied threshold. If feature is NULL, we are exploring
@@ -640,6 +653,15 @@ protected:
 
   std::vector<unsigned int> _empty_var_to_features;
 
+  /// The sorted indices of the active variables on each entity (see getActiveVars())
+  std::map<dof_id_type, std::vector<unsigned int>> _entity_active_vars;
+
+  /// The variables that are active on every entity (e.g. reserve order parameters)
+  std::vector<unsigned int> _default_active_vars;
+
+  /// The indices of all coupled variables
+  std::vector<unsigned int> _all_vars;
+
   /// Determines if the flood counter is elements or not (nodes)
   bool _is_elemental;
 
@@ -15,6 +15,7 @@
 
 class GrainTracker;
 class PolycrystalUserObjectBase;
+class BoundingBoxHash;
 struct GrainDistance;
 
 template <>
@@ -61,6 +62,7 @@ public:
                               std::size_t var_index = 0) const override;
   virtual const std::vector<unsigned int> &
   getVarToFeatureVector(dof_id_type elem_id) const override;
+  virtual const std::vector<unsigned int> & getActiveVars(dof_id_type elem_id) const override;
   virtual unsigned int getFeatureVar(unsigned int feature_id) const override;
   virtual std::size_t getNumberActiveGrains() const override;
   virtual Point getGrainCentroid(unsigned int grain_id) const override;
@@ -109,6 +111,12 @@ protected:
    */
   void remapGrains();
 
+  /**
+   * Build a spatial hash over the (combined) bounding boxes of the passed in features, used to find
+   * the candidates for the pairwise comparisons in the tracking and remapping algorithms.
+   */
+  BoundingBoxHash buildBoundingBoxHash(const std::vector<FeatureData> & features) const;
+
   /**
    * Broadcast essential Grain information to all processors. This method is used to get certain
    * attributes like centroids distributed and whether or not a grain intersects a boundary updated.
@@ -123,6 +131,13 @@ protected:
   void computeMinDistancesFromGrain(FeatureData & grain,
                                     std::vector<std::list<GrainDistance>> & min_distances);
 
+  /**
+   * Finds the grains (indices into _feature_sets, ascending) that can affect the remapping of the
+   * passed in grain: all grains overlapping it and, for each remappable order parameter, the
+   * closest grain. The search region around the grain is grown until these are all found.
+   */
+  void findRemapCandidates(FeatureData & grain, std::vector<std::size_t> & candidates);
+
   /**
    * This is the recursive part of the remapping algorithm. It attempts to remap a grain to a new
    * index and recurses until max_depth is reached.
@@ -232,6 +247,9 @@ private:
 
   /// Boolean to indicate whether this is a Steady or Transient solve
   const bool _is_transient;
+
+  /// Spatial hash of the grains, only set while the grains are being remapped
+  const BoundingBoxHash * _remap_grain_hash;
 };
 
 /**
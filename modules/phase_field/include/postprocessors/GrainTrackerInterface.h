@@ -45,6 +45,13 @@ public:
    */
   virtual const std::vector<unsigned int> & getVarToFeatureVector(dof_id_type elem_id) const = 0;
 
+  /**
+   * Returns the sorted indices of the variables (order parameters) that are active on a particular
+   * element, i.e. variables with a grain or the halo of a grain on the element. The other
+   * variables are (nearly) zero on the element.
+   */
+  virtual const std::vector<unsigned int> & getActiveVars(dof_id_type elem_id) const = 0;
+
   /**
    * Return the variable index (typically order parameter) for the given feature. Returns
    * "invalid_id"
@@ -10,6 +10,8 @@
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
 
+#include <cstdint>
+
 class EBSDReader;
 
 template <>
@@ -182,6 +184,45 @@ protected:
 
   /// Build grain and phase weight maps
   void buildNodeWeightMaps();
+
+  ///@{ Number of real (angles and coordinates) and integer (feature id, phase, symmetry) columns
+  static const unsigned int _real_columns = 6;
+  static const unsigned int _int_columns = 3;
+  ///@}
+
+  /// Identifies (and versions) the binary cache file format
+  static const char _cache_magic[8];
+
+  /**
+   * Parse the EBSD text file into flat arrays of the real data (including the custom columns) and
+   * of the integer data, one row per data point in the order of the file
+   */
+  void readTextFile(const std::string & filename,
+                    unsigned int dim,
+                    std::vector<Real> & real_data,
+                    std::vector<unsigned int> & int_data) const;
+
+  /**
+   * Read the parsed data from the binary cache file. Returns false if the cache does not exist, was
+   * not written for the current EBSD file, or holds more than max_points data points.
+   */
+  bool readBinaryCache(const std::string & cache_filename,
+                       const std::string & filename,
+                       std::size_t max_points,
+                       std::vector<Real> & real_data,
+                       std::vector<unsigned int> & int_data) const;
+
+  /// Write the parsed data to the binary cache file
+  void writeBinaryCache(const std::string & cache_filename,
+                        const std::string & filename,
+                        const std::vector<Real> & real_data,
+                        const std::vector<unsigned int> & int_data) const;
+
+  /**
+   * Get the size and modification time (in nanoseconds, where the platform provides them) of a
+   * file, returns false if the file does not exist
+   */
+  static bool fileStamp(const std::string & filename, uint64_t & size, int64_t & mtime);
 };
 
 #endif // EBSDREADER_H
@@ -9,8 +9,6 @@
 
 #include "FeatureFloodCount.h"
 
-#include "libmesh/dense_matrix.h"
-
 // Forward Declarations
 class PolycrystalUserObjectBase;
 
@@ -107,10 +105,11 @@ protected:
                                              unsigned int & new_id) override;
 
   /**
-   * Builds a dense adjacency matrix based on the discovery of grain neighbors and halos
-   * surrounding each grain.
+   * Builds a sparse adjacency graph (list of neighbors for each grain) based on the discovery of
+   * grain neighbors and halos surrounding each grain. Only grains with overlapping bounding boxes
+   * along the x-direction are compared.
    */
-  void buildGrainAdjacencyMatrix();
+  void buildGrainAdjacencyGraph();
 
   /**
    * Method that runs a coloring algorithm to assign OPs to grains.
@@ -127,6 +126,20 @@ protected:
    */
   bool isGraphValid(unsigned int vertex, unsigned int color);
 
+  /**
+   * Built-in DSATUR algorithm, the grain with the most distinct neighbor colors (ties broken by the
+   * number of neighbors) is colored next with the smallest valid color.
+   * @return false if more colors than order parameters are required
+   */
+  bool colorGraphDSATUR();
+
+  /**
+   * Built-in largest-first algorithm, the grains are colored by decreasing number of neighbors with
+   * the smallest valid color.
+   * @return false if more colors than order parameters are required
+   */
+  bool colorGraphLargestFirst();
+
   /**
    * Prints out the adjacency matrix in a nicely spaced integer format.
    */
@@ -135,8 +148,8 @@ protected:
   /*************************************************
    *************** Data Structures *****************
    ************************************************/
-  /// The dense adjacency matrix
-  std::unique_ptr<DenseMatrix<Real>> _adjacency_matrix;
+  /// The sparse adjacency graph, the sorted list of neighboring grains for each grain
+  std::vector<std::vector<unsigned int>> _adjacency_graph;
 
   /// mesh dimension
   const unsigned int _dim;
@@ -8,6 +8,7 @@
 #define POLYCRYSTALVORONOI_H
 
 #include "PolycrystalUserObjectBase.h"
+#include "PeriodicKDTree.h"
 
 // Forward Declarations
 class PolycrystalVoronoi;
@@ -40,6 +41,9 @@ protected:
   Point _range;
 
   std::vector<Point> _centerpoints;
+
+  /// Spatial index for the closest grain center queries
+  std::unique_ptr<PeriodicKDTree> _center_tree;
 };
 
 #endif // POLYCRYSTALVORONOI_H
@@ -0,0 +1,66 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef BOUNDINGBOXHASH_H
+#define BOUNDINGBOXHASH_H
+
+#include "Moose.h"
+
+#include "libmesh/mesh_tools.h"
+
+#include <array>
+
+/**
+ * Uniform grid (spatial hash) over a fixed set of bounding boxes. Each box is stored in every grid
+ * cell it overlaps so that the boxes intersecting a query box are found by only inspecting the
+ * cells that the query box overlaps. The cell size follows the average box extent, which keeps the
+ * number of boxes per cell roughly constant.
+ */
+class BoundingBoxHash
+{
+public:
+  BoundingBoxHash(const std::vector<MeshTools::BoundingBox> & boxes);
+
+  /**
+   * Find the indices of all stored boxes that intersect the passed in box. The indices are
+   * returned in ascending order.
+   */
+  void query(const MeshTools::BoundingBox & box, std::vector<std::size_t> & indices) const;
+
+  /// Returns the smallest box containing all of the stored boxes
+  const MeshTools::BoundingBox & domain() const { return _domain; }
+
+  /// Returns the smallest box containing all of the passed in boxes
+  static MeshTools::BoundingBox combine(const std::vector<MeshTools::BoundingBox> & boxes);
+
+protected:
+  /// Returns false for boxes that have never been extended (min > max)
+  static bool isValid(const MeshTools::BoundingBox & box);
+
+  /// Range of the cell indices (in each direction) covered by a box
+  void cellRange(const MeshTools::BoundingBox & box,
+                 std::array<unsigned int, LIBMESH_DIM> & begin,
+                 std::array<unsigned int, LIBMESH_DIM> & end) const;
+
+  /// The stored boxes
+  std::vector<MeshTools::BoundingBox> _boxes;
+
+  /// Smallest box containing all of the stored boxes
+  MeshTools::BoundingBox _domain;
+
+  /// Lower corner of the grid
+  Point _origin;
+
+  ///@{ Number and size of the cells in each direction
+  std::array<unsigned int, LIBMESH_DIM> _n_cells;
+  std::array<Real, LIBMESH_DIM> _cell_size;
+  ///@}
+
+  /// Indices of the boxes overlapping each cell
+  std::vector<std::vector<std::size_t>> _cells;
+};
+
+#endif // BOUNDINGBOXHASH_H
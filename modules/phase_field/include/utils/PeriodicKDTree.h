@@ -0,0 +1,56 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef PERIODICKDTREE_H
+#define PERIODICKDTREE_H
+
+#include "KDTree.h"
+
+class MooseMesh;
+
+/**
+ * Nearest neighbor search for a fixed set of points (e.g. grain centers) that accounts for the
+ * periodic boundaries of a nonlinear variable. A single KDTree is built over the points and the
+ * periodic images of the query point are only searched when they can be closer than the neighbors
+ * found so far. The results match a brute-force search using MooseMesh::minPeriodicDistance().
+ */
+class PeriodicKDTree
+{
+public:
+  PeriodicKDTree(const std::vector<Point> & points,
+                 const MooseMesh & mesh,
+                 unsigned int nonlinear_var_num,
+                 unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the (at most) n points closest to the point p and return their indices and (periodic)
+   * distances sorted by distance.
+   */
+  void neighborSearch(const Point & p,
+                      unsigned int n,
+                      std::vector<std::size_t> & indices,
+                      std::vector<Real> & distances) const;
+
+  /// Convenience function returning the index of the closest point
+  std::size_t nearestPoint(const Point & p) const;
+
+protected:
+  /// The points stored in the tree
+  std::vector<Point> _points;
+
+  /// The tree over the points
+  KDTree _kd_tree;
+
+  ///@{ Bounding box of the points
+  Point _bottom_left;
+  Point _top_right;
+  ///@}
+
+  /// Translations to all periodic images of a query point (excluding the zero translation)
+  std::vector<RealVectorValue> _periodic_shifts;
+};
+
+#endif // PERIODICKDTREE_H
@@ -14,6 +14,8 @@
 #include "Sampler.h"
 
 class SamplerMultiApp;
+class StochasticToolsTransfer;
+class Backup;
 
 template <>
 InputParameters validParams<SamplerMultiApp>();
@@ -23,14 +25,71 @@ class SamplerMultiApp : public TransientMultiApp, public SamplerInterface
 public:
   SamplerMultiApp(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
+  virtual void advanceStep() override;
+
+  virtual bool needsRestoration() override;
+
+  virtual void resetApp(unsigned int global_app, Real time) override;
+
+  virtual Real computeDT() override;
+
   /**
    * Return the Sampler object for this MultiApp.
    */
   Sampler & getSampler() const { return _sampler; }
 
+  /**
+   * Return true if the sub-applications are reused for several rows of the Sampler data.
+   */
+  bool isBatch() const { return _batch; }
+
+  /**
+   * Register a transfer that will be executed for every row in batch mode.
+   */
+  void addBatchTransfer(StochasticToolsTransfer & transfer);
+
+  /**
+   * Return the range [begin, end) of the Sampler rows that are solved by the local
+   * sub-applications, see Sampler::getSampleRows().
+   */
+  std::pair<unsigned int, unsigned int> getLocalRowRange() const;
+
 protected:
   /// Sampler to utilize for creating MultiApps
   Sampler & _sampler;
+
+  /// True when the sub-applications are reused for several rows ("batch-reset" mode)
+  const bool _batch;
+
+private:
+  /**
+   * Solve the rows of the local sub-applications one after the other, restoring the
+   * sub-application to its initial state before each row.
+   */
+  bool solveStepBatch();
+
+  /**
+   * Return the first Sampler row solved by a sub-application, the rows are divided evenly among the
+   * sub-applications in batch mode.
+   * @param global_app The global index of the sub-application
+   */
+  unsigned int rowBegin(unsigned int global_app) const;
+
+  /// Total number of rows of the Sampler data
+  const unsigned int _total_num_rows;
+
+  /// Transfers that are executed for each row in batch mode
+  std::vector<StochasticToolsTransfer *> _batch_transfers;
+
+  /// Executioners of the local sub-applications in batch mode
+  std::vector<Executioner *> _batch_executioners;
+
+  /// The initial state of the local sub-applications in batch mode
+  std::vector<std::shared_ptr<Backup>> _batch_initial_states;
 };
 
 #endif
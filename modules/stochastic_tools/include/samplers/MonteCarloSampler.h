@@ -24,6 +24,9 @@ public:
 
 protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual void sampleRows(unsigned int begin, unsigned int end, DenseMatrix<Real> & rows) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+  virtual void sampleAdvance() override;
 
   /// Number of monte carlo samples to create for each distribution
   const std::size_t _num_samples;
@@ -26,6 +26,9 @@ protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
   virtual void sampleSetUp() override;
   virtual void sampleTearDown() override;
+  virtual void sampleRows(unsigned int begin, unsigned int end, DenseMatrix<Real> & rows) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+  virtual void sampleAdvance() override;
 
   /// Number of Monte Carlo samples to create for each Sobol matrix
   const std::size_t _num_samples;
@@ -9,7 +9,7 @@
 #define SAMPLERPOSTPROCESSORTRANSFER_H
 
 // MOOSE includes
-#include "MultiAppTransfer.h"
+#include "StochasticToolsTransfer.h"
 #include "Sampler.h"
 
 // Forward declarations
@@ -24,12 +24,14 @@ InputParameters validParams<SamplerPostprocessorTransfer>();
 /**
  * Transfer Postprocessor from sub-applications to the master application.
  */
-class SamplerPostprocessorTransfer : public MultiAppTransfer
+class SamplerPostprocessorTransfer : public StochasticToolsTransfer
 {
 public:
   SamplerPostprocessorTransfer(const InputParameters & parameters);
   virtual void execute() override;
   virtual void initialSetup() override;
+  virtual void initializeBatch() override;
+  virtual void executeBatch(unsigned int app_index, unsigned int row_index) override;
 
 protected:
   /// Name of VPP that will store the data
@@ -46,6 +48,12 @@ protected:
 
   /// Name of Postprocessor transferring from
   const std::string & _sub_pp_name;
+
+  /// The rows solved on this processor in batch mode
+  std::vector<unsigned int> _batch_rows;
+
+  /// The Postprocessor values of the rows solved on this processor in batch mode
+  std::vector<PostprocessorValue> _batch_values;
 };
 
 #endif
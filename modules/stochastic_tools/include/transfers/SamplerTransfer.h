@@ -9,12 +9,13 @@
 #define SAMPLERTRANSFER_H
 
 // MOOSE includes
-#include "MultiAppTransfer.h"
+#include "StochasticToolsTransfer.h"
 #include "Sampler.h"
 
 // Forward declarations
 class SamplerTransfer;
 class SamplerReceiver;
+class SamplerMultiApp;
 
 template <>
 InputParameters validParams<SamplerTransfer>();
@@ -22,19 +23,36 @@ InputParameters validParams<SamplerTransfer>();
 /**
  * Copy each row from each DenseMatrix to the sub-applications SamplerReceiver object.
  */
-class SamplerTransfer : public MultiAppTransfer
+class SamplerTransfer : public StochasticToolsTransfer
 {
 public:
   SamplerTransfer(const InputParameters & parameters);
   virtual void execute() override;
+  virtual void initializeBatch() override;
+  virtual void executeBatch(unsigned int app_index, unsigned int row_index) override;
 
 protected:
   /**
    * Return the SamplerReceiver object and perform error checking.
    * @param app_index The global sup-app index
+   * @param row_index The global row of the Sampler data that is transferred
    */
-  SamplerReceiver * getReceiver(unsigned int app_index,
-                                const std::vector<DenseMatrix<Real>> & samples);
+  SamplerReceiver * getReceiver(unsigned int app_index, unsigned int row_index);
+
+  /**
+   * Copy a row of the Sampler data to the SamplerReceiver of a sub-application.
+   * @param app_index The global sup-app index
+   * @param row_index The global row of the Sampler data, it must be a local row
+   */
+  void transferRow(unsigned int app_index, unsigned int row_index);
+
+  /**
+   * Compute the Sampler rows for the local sub-applications.
+   */
+  void updateLocalSamples();
+
+  /// The SamplerMultiApp that this transfer is working with
+  SamplerMultiApp * _sampler_multi_app;
 
   /// Storage for the list of parameters to control
   const std::vector<std::string> & _parameter_names;
@@ -45,8 +63,11 @@ protected:
   /// The name of the SamplerReceiver Control object on the sub-application
   const std::string & _receiver_name;
 
-  /// The matrix and row for each MultiApp
-  std::vector<std::pair<unsigned int, unsigned int>> _multi_app_matrix_row;
+  /// The Sampler rows for the local sub-applications, only these rows are computed
+  DenseMatrix<Real> _local_samples;
+
+  /// The global index of the first row in _local_samples
+  unsigned int _local_row_begin;
 };
 
 #endif
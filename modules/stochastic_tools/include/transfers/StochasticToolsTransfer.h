@@ -0,0 +1,44 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef STOCHASTICTOOLSTRANSFER_H
+#define STOCHASTICTOOLSTRANSFER_H
+
+// MOOSE includes
+#include "MultiAppTransfer.h"
+
+// Forward declarations
+class StochasticToolsTransfer;
+
+template <>
+InputParameters validParams<StochasticToolsTransfer>();
+
+/**
+ * Base class for the transfers of a SamplerMultiApp. In addition to the normal execute() these
+ * transfers are able to operate on a single row of the Sampler data, which is used by the
+ * SamplerMultiApp when the sub-applications are reused for several rows ("batch-reset" mode).
+ */
+class StochasticToolsTransfer : public MultiAppTransfer
+{
+public:
+  StochasticToolsTransfer(const InputParameters & parameters);
+
+  /**
+   * Called by the SamplerMultiApp in batch mode before any of the local rows are solved.
+   */
+  virtual void initializeBatch() {}
+
+  /**
+   * Transfer the data for a single row in batch mode. The SamplerMultiApp calls this before the
+   * row is solved for "to_multiapp" transfers and after it is solved for "from_multiapp" ones.
+   * @param app_index The global index of the sub-application solving the row
+   * @param row_index The global index of the row (across all Sampler matrices)
+   */
+  virtual void executeBatch(unsigned int app_index, unsigned int row_index) = 0;
+};
+
+#endif
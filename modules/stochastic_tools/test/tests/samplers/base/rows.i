@@ -0,0 +1,53 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform]
+    type = UniformDistribution
+    lower_bound = 1980
+    upper_bound = 2017
+  [../]
+  [./uniform_2]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = SobolSampler
+    n_samples = 5
+    distributions = 'uniform uniform_2'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./test]
+    type = TestSampler
+    sampler = sample
+    test_type = rows
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+[]
@@ -0,0 +1,132 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef FINITESTRAINCRYSTALPLASTICITYBATCHED_H
+#define FINITESTRAINCRYSTALPLASTICITYBATCHED_H
+
+#include "FiniteStrainCrystalPlasticity.h"
+
+/**
+ * FiniteStrainCrystalPlasticityBatched solves the same constitutive update as
+ * FiniteStrainCrystalPlasticity, but advances all quadrature points of an element
+ * together instead of running one Newton solve per quadrature point.
+ *
+ * Slip system quantities are stored slip system by slip system, with the quadrature
+ * points contiguous (structure of arrays), so the loops over quadrature points carry no
+ * branches. Quadrature points that have converged or failed are masked out of the
+ * remaining iterations. The slip system loops are specialized at compile time for 12,
+ * 24 and 48 slip systems.
+ *
+ * Substepping and line search are not supported; FiniteStrainCrystalPlasticity remains
+ * the reference implementation for those and for validation.
+ */
+class FiniteStrainCrystalPlasticityBatched;
+
+template <>
+InputParameters validParams<FiniteStrainCrystalPlasticityBatched>();
+
+class FiniteStrainCrystalPlasticityBatched : public FiniteStrainCrystalPlasticity
+{
+public:
+  FiniteStrainCrystalPlasticityBatched(const InputParameters & parameters);
+
+protected:
+  /**
+   * Updates the stress at all quadrature points of the current element.
+   */
+  virtual void computeProperties() override;
+
+  /**
+   * Sets up the state of all quadrature points before the solve.
+   */
+  virtual void preSolveBatch();
+
+  /**
+   * Solves the internal variables of all active quadrature points.
+   */
+  virtual void solveStatevarBatch();
+
+  /**
+   * Solves for the stress of all active quadrature points.
+   */
+  virtual void solveStressBatch();
+
+  /**
+   * Calculates the stress residual of all quadrature points in the stress solve.
+   */
+  virtual void calcResidualBatch();
+
+  /**
+   * Calculates the jacobian of all quadrature points in the stress solve.
+   */
+  virtual void calcJacobianBatch();
+
+  /**
+   * Updates the slip system resistances of all quadrature points in the internal
+   * variable solve.
+   */
+  virtual void updateGssBatch();
+
+  /**
+   * Calculates the slip increments and their derivatives for all quadrature points.
+   * N is the number of slip systems, or 0 if it is only known at run time.
+   */
+  template <unsigned int N>
+  void slipIncrementsKernel();
+
+  /**
+   * Calculates the updated slip system resistances for all quadrature points.
+   * N is the number of slip systems, or 0 if it is only known at run time.
+   */
+  template <unsigned int N>
+  void gssUpdateKernel();
+
+  /// Number of quadrature points in the current batch
+  unsigned int _nqp;
+
+  ///@{ Per quadrature point tensors
+  std::vector<RankTwoTensor> _batch_dfgrd;
+  std::vector<RankTwoTensor> _batch_fp_old_inv;
+  std::vector<RankTwoTensor> _batch_fp_inv;
+  std::vector<RankTwoTensor> _batch_fp_prev_inv;
+  std::vector<RankTwoTensor> _batch_fe;
+  std::vector<RankTwoTensor> _batch_pk2;
+  std::vector<RankTwoTensor> _batch_ce_pk2;
+  std::vector<RankTwoTensor> _batch_resid;
+  std::vector<RankFourTensor> _batch_jac;
+  ///@}
+
+  ///@{ Per slip system and quadrature point data, indexed by [i * _nqp + qp]
+  std::vector<RankTwoTensor> _batch_s0;
+  std::vector<Real> _batch_tau;
+  std::vector<Real> _batch_slip_incr;
+  std::vector<Real> _batch_dslipdtau;
+  std::vector<Real> _batch_gss;
+  std::vector<Real> _batch_gss_prev;
+  std::vector<Real> _batch_hb;
+  ///@}
+
+  /// Work space of one value per quadrature point
+  std::vector<Real> _batch_work;
+
+  ///@{ Per quadrature point scalars
+  std::vector<Real> _batch_accslip;
+  std::vector<Real> _batch_rnorm;
+  std::vector<Real> _batch_rnorm0;
+  std::vector<unsigned int> _batch_iter;
+  ///@}
+
+  ///@{ Quadrature point masks
+  /// Quadrature points still iterating on the internal variables
+  std::vector<char> _statevar_active;
+  /// Quadrature points still iterating on the stress
+  std::vector<char> _stress_active;
+  /// Quadrature points for which the constitutive update failed
+  std::vector<char> _failed;
+  ///@}
+};
+
+#endif // FINITESTRAINCRYSTALPLASTICITYBATCHED_H
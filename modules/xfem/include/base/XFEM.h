@@ -12,6 +12,7 @@
 #include "ElementFragmentAlgorithm.h"
 #include "XFEMInterface.h"
 #include "XFEMCrackGrowthIncrement2DCut.h"
+#include "XFEMElementBoundingBoxTree.h"
 
 #include "libmesh/vector_value.h"
 #include "libmesh/quadrature.h"
@@ -83,6 +84,13 @@ public:
   virtual void initSolution(NonlinearSystemBase & nl, AuxiliarySystem & aux);
 
   void buildEFAMesh();
+
+  /**
+   * Rebuild the EFA mesh and the element bounding box tree only if the mesh has
+   * changed or the EFA mesh was modified since they were last built
+   */
+  void updateEFAMesh();
+
   bool markCuts(Real time);
   bool markCutEdgesByGeometry(Real time);
   bool markCutEdgesByState(Real time);
@@ -198,6 +206,24 @@ private:
 
   ElementFragmentAlgorithm _efa_mesh;
 
+  /// Whether _efa_mesh has been modified since it was last built from the mesh
+  bool _efa_mesh_modified;
+
+  /// Number of elements and maximum element id of the mesh when _efa_mesh was last built
+  dof_id_type _efa_mesh_n_elem;
+  dof_id_type _efa_mesh_max_elem_id;
+
+  /// Bounding volume hierarchy used to find the elements that may be cut by a geometric cut
+  XFEMElementBoundingBoxTree _elem_bbox_tree;
+
+  /**
+   * Get the elements that may be intersected by any of the given cuts
+   * @param geometric_cuts Cuts for which the candidate elements are found
+   * @param candidates     Candidate elements, sorted by id
+   */
+  void getCutCandidateElems(const std::vector<const GeometricCutUserObject *> & geometric_cuts,
+                            std::vector<const Elem *> & candidates) const;
+
   /**
    * Data structure to store the nonlinear solution for nodes/elements affected by XFEM
    * For each node/element, this is stored as a vector that contains all components
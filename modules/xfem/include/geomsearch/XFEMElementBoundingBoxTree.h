@@ -0,0 +1,84 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef XFEMELEMENTBOUNDINGBOXTREE_H
+#define XFEMELEMENTBOUNDINGBOXTREE_H
+
+#include "libmesh/bounding_box.h"
+#include "libmesh/mesh_base.h"
+
+#include <vector>
+
+using namespace libMesh;
+
+/**
+ * Bounding volume hierarchy over the axis-aligned bounding boxes of the
+ * elements in a mesh.  It is used by XFEM to find the elements that can
+ * possibly be intersected by a geometric cut without testing every element
+ * in the mesh against every cut.
+ */
+class XFEMElementBoundingBoxTree
+{
+public:
+  /**
+   * @param max_leaf_size Maximum number of elements stored in a leaf of the tree
+   */
+  XFEMElementBoundingBoxTree(unsigned int max_leaf_size = 8);
+
+  /**
+   * (Re)build the tree from all of the elements in the mesh
+   * @param mesh The mesh whose elements are stored in the tree
+   */
+  void build(const MeshBase & mesh);
+
+  /**
+   * Find all elements whose bounding box overlaps the given box.  Elements are
+   * returned sorted by id so that callers visit them in a deterministic order.
+   * @param box        Box to search for
+   * @param candidates Elements overlapping the box
+   */
+  void findCandidates(const BoundingBox & box, std::vector<const Elem *> & candidates) const;
+
+  /// Discard the contents of the tree
+  void clear();
+
+  /// Number of elements stored in the tree
+  std::size_t size() const { return _elems.size(); }
+
+  /// Check whether two boxes overlap (touching boxes are treated as overlapping)
+  static bool boxesOverlap(const BoundingBox & a, const BoundingBox & b);
+
+protected:
+  struct Node
+  {
+    /// Box enclosing all elements below this node
+    BoundingBox box;
+    /// Index of the first child node, or libMesh::invalid_uint for a leaf
+    unsigned int left;
+    unsigned int right;
+    /// Range in _elems stored by a leaf
+    unsigned int begin;
+    unsigned int end;
+  };
+
+  /// Recursively build the subtree for the elements in [begin, end) and return its index
+  unsigned int buildNode(unsigned int begin, unsigned int end);
+
+  /// Maximum number of elements stored in a single leaf
+  const unsigned int _max_leaf_size;
+
+  /// Elements ordered such that every leaf owns a contiguous range
+  std::vector<const Elem *> _elems;
+
+  /// Bounding boxes of the elements in _elems
+  std::vector<BoundingBox> _elem_boxes;
+
+  /// Tree nodes, the root is the first entry
+  std::vector<Node> _nodes;
+};
+
+#endif // XFEMELEMENTBOUNDINGBOXTREE_H
@@ -38,6 +38,8 @@ public:
                                      std::vector<CutFace> & cut_faces,
                                      Real time) const override;
 
+  virtual BoundingBox cutBoundingBox() const override;
+
 protected:
   std::vector<std::pair<Point, Point>> _cut_line_endpoints;
 
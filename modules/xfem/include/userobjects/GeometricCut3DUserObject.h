@@ -45,6 +45,9 @@ protected:
   bool isInsideEdge(const Point & p1, const Point & p2, const Point & p) const;
 
   Real getRelativePosition(const Point & p1, const Point & p2, const Point & p) const;
+
+  /// Inflate a box enclosing the cut plane so that cuts through element faces are not missed
+  BoundingBox inflateCutBoundingBox(const BoundingBox & box) const;
 };
 
 #endif // GEOMETRICCUT3DUSEROBJECT_H
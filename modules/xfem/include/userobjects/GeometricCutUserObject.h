@@ -14,6 +14,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/elem.h"
+#include "libmesh/bounding_box.h"
 
 using namespace libMesh;
 
@@ -71,6 +72,14 @@ public:
 
   Real cutFraction(unsigned int cut_num, Real time) const;
 
+  /**
+   * Get a box enclosing every point that this cut can intersect.  Elements that do
+   * not overlap this box are skipped when cuts are marked.  The default box is
+   * unbounded, so derived classes that do not override this are tested against
+   * every element.
+   */
+  virtual BoundingBox cutBoundingBox() const;
+
 protected:
   std::vector<std::pair<Real, Real>> _cut_time_ranges;
 };
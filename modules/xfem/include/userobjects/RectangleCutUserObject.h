@@ -27,6 +27,8 @@ public:
   virtual const std::vector<Point>
   getCrackFrontPoints(unsigned int num_crack_front_points) const override;
 
+  virtual BoundingBox cutBoundingBox() const override;
+
 protected:
   std::vector<Real> _cut_data;
 
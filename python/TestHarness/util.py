@@ -324,6 +324,31 @@ def getIfAsioExists(moose_dir):
         option_set.add('FALSE')
     return option_set
 
+# PETSc's thread safety is not recorded by libMesh, so it is read from the PETSc configuration
+def getPetscThreadSafety():
+    option_set = set(['ALL'])
+
+    petsc_dir = os.environ.get('PETSC_DIR', '')
+    petsc_arch = os.environ.get('PETSC_ARCH', '')
+    filenames = [
+      os.path.join(petsc_dir, petsc_arch, 'include', 'petscconf.h'), # In-place build
+      os.path.join(petsc_dir, 'include', 'petscconf.h')              # Installed
+      ]
+
+    for filename in filenames:
+        if petsc_dir and os.path.exists(filename):
+            f = open(filename)
+            contents = f.read()
+            f.close()
+
+            if re.search(r'#define\s+PETSC_HAVE_THREADSAFETY\s+1', contents):
+                option_set.add('TRUE')
+                return option_set
+            break
+
+    option_set.add('FALSE')
+    return option_set
+
 def getLibMeshConfigOption(libmesh_dir, option):
     # Some tests work differently with parallel mesh enabled
     # We need to detect this condition
@@ -0,0 +1,74 @@
+# A JIT compiled ParsedFunction with a Postprocessor valued variable. The value goes through the
+# compiled parser while the gradient is still evaluated by libMesh::ParsedFunction, so both have to
+# see the current Postprocessor value: the exact solution a * x matches v = t * x in every step
+# only if the slope a follows the Postprocessor.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[Functions]
+  [./slope]
+    type = ParsedFunction
+    value = t
+  [../]
+  [./v_fn]
+    type = ParsedFunction
+    value = 't * x'
+  [../]
+  [./exact]
+    type = ParsedFunction
+    value = 'a * x'
+    vars = 'a'
+    vals = 'slope_pp'
+    enable_jit = true
+  [../]
+[]
+
+[AuxKernels]
+  [./v]
+    type = FunctionAux
+    variable = v
+    function = v_fn
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Postprocessors]
+  [./h1_error]
+    type = ElementH1SemiError
+    variable = v
+    function = exact
+  [../]
+  [./l2_error]
+    type = ElementL2Error
+    variable = v
+    function = exact
+  [../]
+  [./slope_pp]
+    type = FunctionValuePostprocessor
+    function = slope
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,141 @@
+# The conforming problem with the mortar constraint evaluated on the displaced mesh. Both blocks
+# and the mortar interface are translated rigidly by a different amount in every time step, so the
+# mortar projections are recomputed after each geometric search update and reused over the Newton
+# iterations in between. The solution does not depend on the translation and matches the gold of
+# the conforming test.
+[Mesh]
+  file = 2blk-conf.e
+  displacements = 'disp_x disp_y'
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./exact_sln]
+    type = ParsedFunction
+    value = y
+  [../]
+  [./ffn]
+    type = ParsedFunction
+    value = 0
+  [../]
+  [./disp_x_fn]
+    type = ParsedFunction
+    value = 0.2*t
+  [../]
+  [./disp_y_fn]
+    type = ParsedFunction
+    value = 0.1*t
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./lm]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./ffn]
+    type = BodyForce
+    variable = u
+    function = ffn
+  [../]
+[]
+
+[AuxKernels]
+  [./disp_x]
+    type = FunctionAux
+    variable = disp_x
+    function = disp_x_fn
+    execute_on = 'initial timestep_begin'
+  [../]
+  [./disp_y]
+    type = FunctionAux
+    variable = disp_y
+    function = disp_y_fn
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Constraints]
+  [./ced]
+    type = EqualValueConstraint
+    variable = lm
+    interface = middle
+    master_variable = u
+    use_displaced_mesh = true
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '1 2 3 4'
+    function = exact_sln
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error]
+    type = ElementL2Error
+    variable = u
+    function = exact_sln
+    block = '1 2'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./fmp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  # Every step solves the same steady problem on a translated mesh
+  type = Transient
+  num_steps = 2
+  dt = 0.5
+  nl_rel_tol = 1e-11
+  nl_abs_tol = 1e-10
+  l_tol = 1e-10
+[]
+
+[Outputs]
+  # Only write the initial condition and the final solution, like the Steady conforming test
+  file_base = conforming_out
+  [./exodus]
+    type = Exodus
+    hide = 'disp_x disp_y'
+    execute_on = 'initial final'
+  [../]
+[]
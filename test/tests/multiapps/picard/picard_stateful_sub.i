@@ -0,0 +1,76 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 1
+  [../]
+  [./right_v]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Materials]
+  # Doubles every time step, so a restore that missed the stateful properties would show
+  [./stateful]
+    type = StatefulMaterial
+    initial_diffusivity = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./diffusivity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = diffusivity
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_abs_tol = 1e-10
+[]
+
+[Outputs]
+  csv = true
+  execute_on = timestep_end
+[]
+
@@ -0,0 +1,85 @@
+# The master and sub-app are coupled through the average of their solutions, which are spatially
+# uniform. Without relaxation of the transferred postprocessor the Picard iterations diverge.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./force_u]
+    type = BodyForce
+    variable = u
+    value = 10
+    postprocessor = v_avg
+  [../]
+  [./source_u]
+    type = BodyForce
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./u_avg]
+    type = ElementAverageValue
+    variable = u
+    execute_on = 'initial timestep_end'
+  [../]
+  [./v_avg]
+    type = Receiver
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+  picard_max_its = 30
+  relaxation_factor = 0.5
+  relaxed_postprocessors = v_avg
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_begin
+    positions = '0 0 0'
+    input_files = picard_relaxed_pp_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./v_from_sub]
+    type = MultiAppPostprocessorTransfer
+    direction = from_multiapp
+    multi_app = sub
+    from_postprocessor = v_avg
+    to_postprocessor = v_avg
+    reduction_type = average
+  [../]
+  [./u_to_sub]
+    type = MultiAppPostprocessorTransfer
+    direction = to_multiapp
+    multi_app = sub
+    from_postprocessor = u_avg
+    to_postprocessor = u_avg
+  [../]
+[]
@@ -0,0 +1,44 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+[]
+
+[Variables]
+  [./v]
+    initial_condition = 1
+  [../]
+[]
+
+[Kernels]
+  [./time_v]
+    type = TimeDerivative
+    variable = v
+  [../]
+  [./force_v]
+    type = BodyForce
+    variable = v
+    value = -15
+    postprocessor = u_avg
+  [../]
+[]
+
+[Postprocessors]
+  [./u_avg]
+    type = Receiver
+  [../]
+  [./v_avg]
+    type = ElementAverageValue
+    variable = v
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+[]
@@ -0,0 +1,209 @@
+# Stateful material properties, a penetration locator, a MultiApp that is backed up every time step,
+# and a SolutionUserObject. The breakdown is taken during the solve (when the Assembly blocks and the
+# system matrix are in use) and each category is checked to be non-empty at the end of the step.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./penetration]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./penetration]
+    type = PenetrationAux
+    variable = penetration
+    boundary = left
+    paired_boundary = right
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./stateful]
+    type = StatefulMaterial
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    input_files = memory_usage_categories_sub.i
+    positions = '0 0 0'
+  [../]
+[]
+
+[UserObjects]
+  [./solution]
+    type = SolutionUserObject
+    mesh = memory_usage_solution.e
+    system_variables = continuous_variable
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./memory]
+    type = MemoryUsageBreakdown
+    print_table = false
+    execute_on = nonlinear
+    outputs = none
+  [../]
+[]
+
+[Functions]
+  [./has_material_properties]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = material_properties_bytes
+  [../]
+  [./has_geometric_search]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = geometric_search_bytes
+  [../]
+  [./has_system_matrices]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = system_matrices_bytes
+  [../]
+  [./has_multiapp_backups]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = multiapp_backups_bytes
+  [../]
+  [./has_solution_user_objects]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = solution_user_objects_bytes
+  [../]
+  [./has_assembly]
+    type = ParsedFunction
+    value = 'if(bytes > 0, 1, 0)'
+    vars = bytes
+    vals = assembly_bytes
+  [../]
+[]
+
+[Postprocessors]
+  [./material_properties_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = material_properties
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./geometric_search_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = geometric_search
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./system_matrices_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = system_matrices
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./multiapp_backups_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = multiapp_backups
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./solution_user_objects_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = solution_user_objects
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./assembly_bytes]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = memory
+    vector_name = assembly
+    index = 0
+    execute_on = nonlinear
+    outputs = none
+  [../]
+  [./has_material_properties]
+    type = FunctionValuePostprocessor
+    function = has_material_properties
+  [../]
+  [./has_geometric_search]
+    type = FunctionValuePostprocessor
+    function = has_geometric_search
+  [../]
+  [./has_system_matrices]
+    type = FunctionValuePostprocessor
+    function = has_system_matrices
+  [../]
+  [./has_multiapp_backups]
+    type = FunctionValuePostprocessor
+    function = has_multiapp_backups
+  [../]
+  [./has_solution_user_objects]
+    type = FunctionValuePostprocessor
+    function = has_solution_user_objects
+  [../]
+  [./has_assembly]
+    type = FunctionValuePostprocessor
+    function = has_assembly
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 0.1
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  csv = true
+[]